@@ -82,7 +82,13 @@ Result Application::Loop()
    {"USB test",        nullptr, &Application::GetMenuStr, this, 8},
    {"Servo test",      nullptr, &Application::GetMenuStr, this, 9},
    {"Touch calibrate", nullptr, &Application::GetMenuStr, this, 10},
-   {"I2C Ping",        nullptr, &Application::GetMenuStr, this, 11}};
+   {"I2C Ping",        nullptr, &Application::GetMenuStr, this, 11},
+   {"Tetris record",   nullptr, &Application::GetMenuStr, this, 12},
+   {"Tetris replay",   nullptr, &Application::GetMenuStr, this, 13},
+   {"Gario record",    nullptr, &Application::GetMenuStr, this, 14},
+   {"Gario replay",    nullptr, &Application::GetMenuStr, this, 15},
+   {"Pong record",     nullptr, &Application::GetMenuStr, this, 16},
+   {"Pong replay",     nullptr, &Application::GetMenuStr, this, 17}};
 
   // Create menu object
   UiMenu menu("Main Menu", main_menu_items, NumberOf(main_menu_items));
@@ -219,6 +225,31 @@ Result Application::Loop()
           IicPing(iic);
           break;
 
+        // Record & replay input for Tetris, Gario and Pong
+        case 11:
+          RunWithInputLog(Tetris::GetInstance(), InputLog::MODE_RECORD, "TETRIS.INP");
+          break;
+
+        case 12:
+          RunWithInputLog(Tetris::GetInstance(), InputLog::MODE_REPLAY, "TETRIS.INP");
+          break;
+
+        case 13:
+          RunWithInputLog(Gario::GetInstance(), InputLog::MODE_RECORD, "GARIO.INP");
+          break;
+
+        case 14:
+          RunWithInputLog(Gario::GetInstance(), InputLog::MODE_REPLAY, "GARIO.INP");
+          break;
+
+        case 15:
+          RunWithInputLog(Pong::GetInstance(), InputLog::MODE_RECORD, "PONG.INP");
+          break;
+
+        case 16:
+          RunWithInputLog(Pong::GetInstance(), InputLog::MODE_REPLAY, "PONG.INP");
+          break;
+
         default:
           break;
       }
@@ -229,6 +260,28 @@ Result Application::Loop()
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   RunWithInputLog   *****************************************************
+// *****************************************************************************
+void Application::RunWithInputLog(AppTask& app, InputLog::Mode mode, const char* file_name)
+{
+  // Start record or replay
+  FRESULT fres = InputLog::GetInstance().Start(mode, file_name);
+  // Run application
+  if(fres == FR_OK)
+  {
+    app.Loop();
+    // Stop record or replay and close file
+    fres = InputLog::GetInstance().Stop();
+  }
+  // Show error
+  if(fres != FR_OK)
+  {
+    UiMsgBox msg_box("Input log file error", "Error");
+    msg_box.Run(3000U);
+  }
+}
+
 // *****************************************************************************
 // ***   IicPing   *************************************************************
 // *****************************************************************************
@@ -442,7 +495,7 @@ Result Application::IicPing(IIic& iic)
 // *****************************************************************************
 // *****************************************************************************
 
-const uint8_t mute_off_img[] = {
+static constexpr uint8_t mute_off_data[] = {
 0xD7, 0xD7, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD7, 0xD7, 0xD7, 0xFB, 0xFB, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -493,7 +546,7 @@ const uint8_t mute_off_img[] = {
 0x00, 0xFB, 0xFB, 0xD7, 0xD7, 0xD7, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD7, 0xD7};
 
-const uint8_t mute_on_img[] = {
+static constexpr uint8_t mute_on_data[] = {
 0xD7, 0xD7, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD7, 0xD7, 0xD7, 0xFB, 0xFB, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -544,15 +597,19 @@ const uint8_t mute_on_img[] = {
 0x00, 0xFB, 0xFB, 0xD7, 0xD7, 0xD7, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 
 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD7, 0xD7};
 
-const ImageDesc mute_img[] = {
-{28, 28, 8, {.img = mute_off_img}, PALETTE_676, PALETTE_676[0xD7]},
-{28, 28, 8, {.img = mute_on_img},  PALETTE_676, PALETTE_676[0xD7]}};
+// Images encoded at compile time, 0xD7 is transparent index in PALETTE_676
+static constexpr auto mute_off_rle = RLE_ENCODE(28, mute_off_data, 0xD7U);
+static constexpr auto mute_on_rle = RLE_ENCODE(28, mute_on_data, 0xD7U);
+
+const RleImageDesc mute_img[] = {
+{28, 28, mute_off_rle.rows, mute_off_rle.data, PALETTE_676},
+{28, 28, mute_on_rle.rows,  mute_on_rle.data,  PALETTE_676}};
 
 // *****************************************************************************
 // ***   Constructor   *********************************************************
 // *****************************************************************************
 SoundControlBox::SoundControlBox(int32_t x, int32_t y, bool mute_flag) :
-                                                        Image(x, y, mute_img[0])
+                                                     RleImage(x, y, mute_img[0])
 {
   // Store mute flag
   mute = mute_flag;
@@ -581,11 +638,11 @@ void SoundControlBox::Action(ActionType action, int32_t tx, int32_t ty, int32_t
       // Update image
       if(mute == true)
       {
-        SetImage(mute_img[0], true); // Don't take semaphore - already taken
+        SetImage(mute_img[0]);
       }
       else
       {
-        SetImage(mute_img[1], true); // Don't take semaphore - already taken
+        SetImage(mute_img[1]);
       }
       // Mute control
       sound_drv.Mute(mute);
@@ -27,6 +27,8 @@
 #include "InputDrv.h"
 #include "SoundDrv.h"
 #include "UiEngine.h"
+#include "InputLog.h"
+#include "RleImage.h"
 
 #include "IIic.h"
 
@@ -63,6 +65,11 @@ class Application : public AppTask
     // Sound driver instance
     SoundDrv& sound_drv = SoundDrv::GetInstance();
 
+    // *************************************************************************
+    // ***   Run application with input record or replay   *********************
+    // *************************************************************************
+    void RunWithInputLog(AppTask& app, InputLog::Mode mode, const char* file_name);
+
     // *************************************************************************
     // ***   I2C Ping function   ***********************************************
     // *************************************************************************
@@ -83,7 +90,7 @@ class Application : public AppTask
 // *****************************************************************************
 // ***   CheckBox Class   ******************************************************
 // *****************************************************************************
-class SoundControlBox : public Image
+class SoundControlBox : public RleImage
 {
   public:
     // *************************************************************************
@@ -0,0 +1,44 @@
+//******************************************************************************
+//  @file EncoderAccel.cpp
+//  @details Application: Encoder velocity & acceleration Class, implementation
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "EncoderAccel.h"
+
+// *****************************************************************************
+// ***   Process   *************************************************************
+// *****************************************************************************
+int32_t EncoderAccel::Process(int32_t cnt, uint32_t time_ms)
+{
+  // Counts and time since start of the measurement window
+  win_cnt += cnt;
+  int32_t dt = (int32_t)(time_ms - win_start_ms);
+  if(dt < 0) dt = 0;
+
+  // Window is long enough - measure velocity & acceleration
+  if(dt >= VELOCITY_WINDOW_MS)
+  {
+    int32_t new_velocity = (win_cnt * 1000) / dt;
+    acceleration = ((new_velocity - velocity) * 1000) / dt;
+    velocity = new_velocity;
+    // Start new window
+    win_start_ms = time_ms;
+    win_cnt = 0;
+    dt = 0;
+  }
+
+  // Velocity at the time of this read, predicted by the acceleration if
+  // window isn't over yet. Prediction can't change direction of rotation.
+  int32_t cur_velocity = velocity + (acceleration * dt) / 1000;
+  if((cur_velocity ^ velocity) < 0) cur_velocity = 0;
+
+  // Movement per count depends on the velocity
+  int32_t step = (accel * abs(cur_velocity)) / 1000;
+  if(step < base) step = base;
+  if(step > max)  step = max;
+
+  return cnt * step;
+}
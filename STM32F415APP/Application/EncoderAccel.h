@@ -0,0 +1,81 @@
+//******************************************************************************
+//  @file EncoderAccel.h
+//  @details Application: Encoder velocity & acceleration Class, header
+//
+//  Converts encoder counts to movement depending on rotation speed. Speed is
+//  calculated from real time of encoder reads over at least
+//  VELOCITY_WINDOW_MS, so counts accumulated during a long frame give the
+//  same speed as the same rotation read in short frames. Counts read sooner
+//  than a window after the last measurement, for example in catch-up logic
+//  steps, use speed predicted by the acceleration.
+//
+//******************************************************************************
+
+#ifndef EncoderAccel_h
+#define EncoderAccel_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// *****************************************************************************
+// ***   Encoder Accel Class   *************************************************
+// *****************************************************************************
+class EncoderAccel
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    // * Movement per count is accel_t * velocity / 1000 where velocity is in
+    // * counts per second, but not less than base_t and not more than max_t.
+    EncoderAccel(int32_t base_t, int32_t accel_t, int32_t max_t) :
+      base(base_t), accel(accel_t), max(max_t) {};
+
+    // *************************************************************************
+    // ***   Process   *********************************************************
+    // *************************************************************************
+    // * Should be called with encoder count since last call and real time of
+    // * the encoder read. Returns movement for this count.
+    int32_t Process(int32_t cnt, uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Reset   ***********************************************************
+    // *************************************************************************
+    // * Should be called before the first Process() call with the time of the
+    // * first encoder read, for example at new game.
+    void Reset(uint32_t time_ms) {win_start_ms = time_ms; win_cnt = 0; velocity = 0; acceleration = 0;}
+
+    // *************************************************************************
+    // ***   Get velocity in counts per second   *******************************
+    // *************************************************************************
+    int32_t GetVelocity(void) const {return velocity;}
+
+    // *************************************************************************
+    // ***   Get acceleration in counts per second^2   *************************
+    // *************************************************************************
+    int32_t GetAcceleration(void) const {return acceleration;}
+
+  private:
+    // Min time to measure velocity in ms
+    static const int32_t VELOCITY_WINDOW_MS = 20;
+
+    // Min movement per count
+    int32_t base;
+    // Movement per count per 1000 counts per second
+    int32_t accel;
+    // Max movement per count
+    int32_t max;
+
+    // Start time of the velocity measurement window
+    uint32_t win_start_ms = 0U;
+    // Counts since start of the velocity measurement window
+    int32_t win_cnt = 0;
+    // Velocity in counts per second
+    int32_t velocity = 0;
+    // Acceleration in counts per second^2
+    int32_t acceleration = 0;
+};
+
+#endif
@@ -0,0 +1,128 @@
+//******************************************************************************
+//  @file GameLoop.cpp
+//  @details Application: Fixed timestep Game Loop Class, implementation
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "GameLoop.h"
+
+// *****************************************************************************
+// ***   Start   ***************************************************************
+// *****************************************************************************
+void GameLoop::Start(void)
+{
+  // Enable CPU cycle counter for frame statistics
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  // First logic step and display update are due now
+  next_update_ms = RtosTick::GetTickCount();
+  next_render_ms = next_update_ms;
+  // Clear statistics
+  steps = 0U;
+  dropped_steps = 0U;
+  logic_us = 0U;
+  render_call_us = 0U;
+  wait_us = 0U;
+  // First frame starts now
+  frame_start_cyc = GetCycles();
+}
+
+// *****************************************************************************
+// ***   Update   **************************************************************
+// *****************************************************************************
+bool GameLoop::Update(void)
+{
+  bool result = false;
+  uint32_t now_ms = RtosTick::GetTickCount();
+
+  // In free run mode one logic step per frame
+  if(free_run)
+  {
+    result = (steps == 0U);
+    if(result) steps++;
+    // Real time steps start from the current time when free run is over
+    next_update_ms = now_ms;
+  }
+  // Check if logic step is due
+  else if((int32_t)(now_ms - next_update_ms) >= 0)
+  {
+    if(steps < max_steps)
+    {
+      next_update_ms += update_ms;
+      steps++;
+      result = true;
+    }
+    else
+    {
+      // Frame is too late to catch up - drop missed steps, so one slow frame
+      // doesn't cause the following frames to be late too
+      uint32_t missed = (now_ms - next_update_ms) / update_ms + 1U;
+      next_update_ms += missed * update_ms;
+      dropped_steps += missed;
+    }
+  }
+
+  // All logic steps for this frame done - save logic time
+  if(result == false)
+  {
+    logic_us = CyclesToUs(GetCycles() - frame_start_cyc);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Render   **************************************************************
+// *****************************************************************************
+void GameLoop::Render(void)
+{
+  uint32_t start_cyc = GetCycles();
+  uint32_t now_ms = RtosTick::GetTickCount();
+
+  // Update display only if logic changed something and display update is due
+  if((steps != 0U) && ((render_ms == 0U) || ((int32_t)(now_ms - next_render_ms) >= 0)))
+  {
+    // Request display update, display task draws changed areas
+    display_drv.UpdateDisplay();
+    // Next display update. Missed display updates don't need catch up.
+    next_render_ms = now_ms + render_ms;
+  }
+
+  render_call_us = CyclesToUs(GetCycles() - start_cyc);
+}
+
+// *****************************************************************************
+// ***   Wait   ****************************************************************
+// *****************************************************************************
+void GameLoop::Wait(void)
+{
+  uint32_t start_cyc = GetCycles();
+
+  // Pause until next logic step
+  int32_t delay = (int32_t)(next_update_ms - RtosTick::GetTickCount());
+  if(free_run)
+  {
+    // Give time to the display task only
+    RtosTick::DelayTicks(1U);
+  }
+  else if(delay > 0)
+  {
+    RtosTick::DelayMs(delay);
+  }
+
+  wait_us = CyclesToUs(GetCycles() - start_cyc);
+
+  // New frame starts
+  steps = 0U;
+  frame_start_cyc = GetCycles();
+}
+
+// *****************************************************************************
+// ***   GetRemainingUs   ******************************************************
+// *****************************************************************************
+int32_t GameLoop::GetRemainingUs(void)
+{
+  return (int32_t)(update_ms * 1000U) - (int32_t)CyclesToUs(GetCycles() - frame_start_cyc);
+}
@@ -0,0 +1,143 @@
+//******************************************************************************
+//  @file GameLoop.h
+//  @details Application: Fixed timestep Game Loop Class, header
+//
+//  Usage:
+//
+//    GameLoop game_loop(TICK_MS);
+//    game_loop.Start();
+//    while(run)
+//    {
+//      // Logic steps due at this frame, each one is TICK_MS long
+//      while(game_loop.Update())
+//      {
+//        // Read input & process game logic
+//      }
+//      // Request display update
+//      game_loop.Render();
+//      // Sleep until next logic step
+//      game_loop.Wait();
+//    }
+//
+//******************************************************************************
+
+#ifndef GameLoop_h
+#define GameLoop_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "DisplayDrv.h"
+
+// *****************************************************************************
+// ***   Game Loop Class   *****************************************************
+// *****************************************************************************
+class GameLoop
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    // * update_ms_t - logic timestep in ms
+    // * render_ms_t - display update period in ms, 0 - after each logic frame
+    // * max_steps_t - max logic steps per frame to catch up after slow frame,
+    // *               steps over this limit are dropped
+    explicit GameLoop(uint32_t update_ms_t, uint32_t render_ms_t = 0U,
+                      uint32_t max_steps_t = 4U) :
+      update_ms(update_ms_t), render_ms(render_ms_t), max_steps(max_steps_t) {};
+
+    // *************************************************************************
+    // ***   Start loop   ******************************************************
+    // *************************************************************************
+    void Start(void);
+
+    // *************************************************************************
+    // ***   Update   **********************************************************
+    // *************************************************************************
+    // * Returns true if one more logic step should be executed in this frame.
+    bool Update(void);
+
+    // *************************************************************************
+    // ***   Render   **********************************************************
+    // *************************************************************************
+    void Render(void);
+
+    // *************************************************************************
+    // ***   Wait   ************************************************************
+    // *************************************************************************
+    void Wait(void);
+
+    // *************************************************************************
+    // ***   Set free run mode   ***********************************************
+    // *************************************************************************
+    // * In free run mode every frame has one logic step and loop doesn't wait
+    // * for step time. Used to replay recorded input faster than real time.
+    void SetFreeRun(bool free_run_t) {free_run = free_run_t;}
+
+    // *************************************************************************
+    // ***   Get remaining frame time in us   **********************************
+    // *************************************************************************
+    // * Wall clock time left until the end of the current logic step period.
+    int32_t GetRemainingUs(void);
+
+    // *************************************************************************
+    // ***   Last frame wall clock times in us   *******************************
+    // *************************************************************************
+    // * Times are measured by the CPU cycle counter in the application task,
+    // * so they include time of any task that preempts it. Display is drawn by
+    // * the display task: Render() only requests update, so drawing time is
+    // * mostly in wait time, or in logic time if display task preempts logic.
+    // * Logic time - from the frame start to the end of the last logic step
+    uint32_t GetLogicTimeUs(void) const {return logic_us;}
+    // * Render call time - time spent in Render() call
+    uint32_t GetRenderCallTimeUs(void) const {return render_call_us;}
+    // * Wait time - time spent in Wait() call
+    uint32_t GetWaitTimeUs(void) const {return wait_us;}
+
+    // *************************************************************************
+    // ***   Get number of dropped logic steps   *******************************
+    // *************************************************************************
+    uint32_t GetDroppedSteps(void) const {return dropped_steps;}
+
+  private:
+    // Display driver instance
+    DisplayDrv& display_drv = DisplayDrv::GetInstance();
+
+    // Logic timestep in ms
+    uint32_t update_ms;
+    // Display update period in ms
+    uint32_t render_ms;
+    // Max logic steps per frame
+    uint32_t max_steps;
+    // Free run flag
+    bool free_run = false;
+
+    // Time of next logic step in ms
+    uint32_t next_update_ms = 0U;
+    // Time of next display update in ms
+    uint32_t next_render_ms = 0U;
+    // Logic steps executed in current frame
+    uint32_t steps = 0U;
+    // Logic steps dropped since start
+    uint32_t dropped_steps = 0U;
+
+    // Frame start in CPU cycles
+    uint32_t frame_start_cyc = 0U;
+    // Last frame wall clock times in us
+    uint32_t logic_us = 0U;
+    uint32_t render_call_us = 0U;
+    uint32_t wait_us = 0U;
+
+    // *************************************************************************
+    // ***   Private: Get CPU cycles   *****************************************
+    // *************************************************************************
+    static uint32_t GetCycles(void) {return DWT->CYCCNT;}
+
+    // *************************************************************************
+    // ***   Private: Convert CPU cycles to us   *******************************
+    // *************************************************************************
+    static uint32_t CyclesToUs(uint32_t cycles) {return cycles / (SystemCoreClock / 1000000U);}
+};
+
+#endif
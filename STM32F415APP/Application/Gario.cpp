@@ -12,217 +12,105 @@
 // ***   Static Data Initialization   ******************************************
 // *****************************************************************************
 
-uint8_t level_data[] =
- {
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x45,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x46,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x45,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x6B,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x45,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6A,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x62,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x46,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x46,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x62,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x6A,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x45,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x46,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
-  0x63,0x20,0x20,0x20,0x63,0x63,0x63,0x62,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x63,0x63,0x63,0x20,0x20,0x20,0x20,0x63,0x62,0x62,
-  0x63,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x65,0x65,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6A,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x65,0x65,0x65,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6A,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x52,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x65,0x65,0x65,0x65,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x6A,0x20,0x20,0x20,0x20,0x20,0x4E,0x4E,0x4E,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x62,0x20,0x20,0x20,0x20,0x63,0x62,0x63,0x62,0x63,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x68,0x69,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x62,0x63,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x20,0x20,0x20,
-  0x20,0x63,0x63,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x20,0x62,0x20,0x20,0x62,
-  0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x63,0x63,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x20,0x20,0x65,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x65,0x20,0x20,0x65,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x63,0x62,0x63,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x65,0x65,0x65,
-  0x65,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6A,0x20,0x20,0x20,
-  0x20,0x20,0x50,0x4B,0x51,0x20,0x20,0x20,0x20,0x20,0x20,0x42,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x67,
-  0x20,0x20,0x42,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x67,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x42,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
-  0x65,0x20,0x20,0x65,0x65,0x20,0x20,0x20,0x20,0x42,0x20,0x20,0x20,0x65,0x65,
-  0x65,0x20,0x20,0x65,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x20,0x20,0x20,0x20,0x42,0x20,0x20,
-  0x20,0x20,0x6A,0x20,0x20,0x20,0x20,0x4E,0x4F,0x4F,0x4F,0x4E,0x20,0x20,0x20,
-  0x20,0x41,0x44,0x43,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x42,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x68,0x69,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x67,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x66,0x67,0x20,0x41,0x44,0x43,0x20,0x20,0x20,0x20,0x20,
-  0x66,0x67,0x20,0x20,0x20,0x20,0x20,0x20,0x42,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x41,0x44,0x43,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x42,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x65,0x65,0x65,0x20,0x20,0x65,0x65,0x65,0x20,0x20,0x41,
-  0x44,0x43,0x20,0x65,0x65,0x65,0x65,0x20,0x20,0x65,0x65,0x65,0x20,0x20,0x20,
-  0x42,0x20,0x68,0x69,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x68,0x69,0x20,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x20,
-  0x20,0x20,0x41,0x44,0x43,0x20,0x20,0x20,0x6A,0x20,0x20,0x20,0x20,0x4B,0x4B,
-  0x4D,0x4B,0x4B,0x20,0x20,0x20,0x41,0x44,0x44,0x44,0x43,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x47,0x48,0x49,0x41,0x44,0x43,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x47,0x48,0x49,0x20,0x20,0x66,0x67,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x66,0x67,0x20,0x47,0x48,0x48,0x49,0x20,0x66,0x67,0x41,0x44,0x44,
-  0x44,0x43,0x20,0x20,0x20,0x20,0x66,0x67,0x47,0x48,0x48,0x48,0x49,0x41,0x44,
-  0x43,0x20,0x20,0x20,0x20,0x47,0x48,0x49,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x47,0x48,0x48,0x49,0x20,0x20,0x20,
-  0x41,0x44,0x44,0x44,0x43,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x47,0x48,0x48,
-  0x48,0x49,0x41,0x44,0x43,0x20,0x20,0x20,0x20,0x20,0x47,0x48,0x49,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x65,0x65,0x65,0x48,0x48,
-  0x65,0x65,0x65,0x65,0x41,0x44,0x44,0x44,0x65,0x65,0x65,0x65,0x65,0x20,0x20,
-  0x65,0x65,0x65,0x65,0x49,0x41,0x44,0x43,0x66,0x67,0x20,0x20,0x47,0x48,0x49,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x67,0x65,0x65,0x65,0x65,
-  0x65,0x65,0x65,0x65,0x65,0x20,0x20,0x41,0x44,0x44,0x44,0x43,0x20,0x20,0x65,
-  0x20,0x20,0x20,0x47,0x4B,0x4B,0x4C,0x4B,0x4B,0x20,0x20,0x20,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x20,0x20,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x20,0x20,0x20,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x20,0x20,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x20,0x20,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x20,0x20,0x20,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x20,0x20,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,
-  0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64};
-
-uint16_t levelH = 14;
-uint16_t levelW = 216;
-
-#define xyToLvlIdx(x, y) (((y)/8)*levelW + (x)/8)
-
-const uint8_t tiles_0_data[] = {
+// Level size in tiles
+static const uint16_t levelH = 14;
+static const uint16_t levelW = 216;
+
+// Level in source form: one string per tile row, one character per tile.
+// Blocks:      'b'-'i' - tiles 1-8
+// Decorations: 'A'-'I' - tiles 10-18, 'K'-'Q' - tiles 19-25
+// Flag:        'j' - tile 26(pole), 'k' - tile 27(top)
+// Empty space: ' '
+static constexpr char level_src[] =
+  "                                                                                                                                                                                                                        "
+  "                                                                                                                                                                                                                        "
+  "                   EF                                     EF                                      EF                                                                                                       k            "
+  "                                                                                                                                                   EF                   EF                                 j            "
+  "                       b        EF              EF                                                               b                                                                              ee         j            "
+  "   EF                                                                 EF           cccccccc   cccb                           ccc    cbbc                                                       eee         j            "
+  "                                                                                                                                                                                              eeee         j            "
+  "                                                                   R                                                                                                                         eeeee         j     NNN    "
+  "                b    cbcbc                       hi         hi                  cbc              c     cc     b  b  b     c          cc      e  e          ee  e            ccbc            eeeeee         j     PKQ    "
+  "  B                                      hi      fg  B      fg                                       B                                      ee  ee    B   eee  ee                          eeeeeee    B    j    NOOON   "
+  " ADC             B            hi         fg      fg ADC     fg      B                               ADC              B                     eee  eee  ADC eeee  eee   B hi              hi eeeeeeee   ADC   j    KKMKK   "
+  "ADDDC        GHIADC      GHI  fg         fg GHHI fgADDDC    fgGHHHIADC    GHI               GHHI   ADDDC       GHHHIADC     GHI           eeeeHHeeeeADDDeeeee  eeeeIADCfg  GHI         fgeeeeeeeee  ADDDC  e   GKKLKK   "
+  "dddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd  ddddddddddddddd   ddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd  ddddddddddddddddddddddddddddddddddddddddddddddddddddddddd"
+  "dddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd  ddddddddddddddd   ddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd  ddddddddddddddddddddddddddddddddddddddddddddddddddddddddd";
+
+// *****************************************************************************
+// ***   LevelTileIdx   ********************************************************
+// *****************************************************************************
+// * Translate level source character to tile index
+static constexpr uint8_t LevelTileIdx(char c)
+{
+  switch(c)
+  {
+    // Blocks
+    case 'b': return 1;
+    case 'c': return 2;
+    case 'd': return 3;
+    case 'e': return 4;
+    case 'f': return 5;
+    case 'g': return 6;
+    case 'h': return 7;
+    case 'i': return 8;
+
+    // Decoration
+    case 'A': return 10;
+    case 'B': return 11;
+    case 'C': return 12;
+    case 'D': return 13;
+    case 'E': return 14;
+    case 'F': return 15;
+    case 'G': return 16;
+    case 'H': return 17;
+    case 'I': return 18;
+    case 'K': return 19;
+    case 'L': return 20;
+    case 'M': return 21;
+    case 'N': return 22;
+    case 'O': return 23;
+    case 'P': return 24;
+    case 'Q': return 25;
+
+    case 'j': return 26;
+    case 'k': return 27;
+
+    case ' ': return 0x1F;
+
+    // Unknown characters stay as is
+    default:  return (uint8_t)c;
+  }
+}
+
+// Translated level data
+template<uint32_t N> struct LevelData
+{
+  uint8_t data[N];
+};
+
+// *****************************************************************************
+// ***   TranslateLevel   ******************************************************
+// *****************************************************************************
+// * Translate level source string to tile indexes at compile time
+template<uint32_t N> static constexpr LevelData<N - 1U> TranslateLevel(const char (&src)[N])
+{
+  LevelData<N - 1U> lvl = {};
+  for(uint32_t i = 0U; i < N - 1U; i++)
+  {
+    lvl.data[i] = LevelTileIdx(src[i]);
+  }
+  return lvl;
+}
+
+// Level data translated at compile time and stored in flash
+static constexpr LevelData<sizeof(level_src) - 1U> level = TranslateLevel(level_src);
+static_assert(sizeof(level.data) == levelW * levelH, "Wrong level size");
+
+// Index of transparent COLOR_MAGENTA in PALETTE_884
+static const uint8_t TRANSPARENT_IDX = 0xC7U;
+
+static constexpr uint8_t tiles_0_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
 0x00, 0x15, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x15, 0x00, 
@@ -240,7 +128,7 @@ const uint8_t tiles_0_data[] = {
 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_1_data[] = {
+static constexpr uint8_t tiles_1_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
 0x00, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x0C, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x00, 
@@ -258,7 +146,7 @@ const uint8_t tiles_1_data[] = {
 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_2_data[] = {
+static constexpr uint8_t tiles_2_data[] = {
 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
@@ -276,7 +164,7 @@ const uint8_t tiles_2_data[] = {
 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_3_data[] = {
+static constexpr uint8_t tiles_3_data[] = {
 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x00, 
 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x00, 
@@ -294,7 +182,7 @@ const uint8_t tiles_3_data[] = {
 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15};
 
-const uint8_t tiles_4_data[] = {
+static constexpr uint8_t tiles_4_data[] = {
 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x0C, 
 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x0C, 0x0C, 
@@ -312,7 +200,7 @@ const uint8_t tiles_4_data[] = {
 0x6F, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 
 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00};
 
-const uint8_t tiles_5_data[] = {
+static constexpr uint8_t tiles_5_data[] = {
 0xC7, 0x00, 0x18, 0x18, 0x28, 0x28, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x30, 0x30, 0x30, 
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x28, 0x30, 0x28, 0x28, 
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x28, 0x28, 0x30, 0x28, 0x30, 0x18, 0x30, 
@@ -330,7 +218,7 @@ const uint8_t tiles_5_data[] = {
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x30, 
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x30, 0x30, 0x30, 0x30};
 
-const uint8_t tiles_6_data[] = {
+static constexpr uint8_t tiles_6_data[] = {
 0x30, 0x28, 0x28, 0x30, 0x28, 0x30, 0x30, 0x38, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
 0x30, 0x30, 0x28, 0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x00, 0xC7, 
 0x30, 0x30, 0x28, 0x30, 0x38, 0x28, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
@@ -348,7 +236,7 @@ const uint8_t tiles_6_data[] = {
 0x30, 0x28, 0x30, 0x28, 0x30, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7, 
 0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7};
 
-const uint8_t tiles_7_data[] = {
+static constexpr uint8_t tiles_7_data[] = {
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x18, 0x28, 0x28, 0x30, 
 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x30, 0x18, 0x30, 0x28, 0x30, 
 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x18, 0x28, 0x30, 0x28, 0x18, 0x18, 0x30, 0x28, 
@@ -366,7 +254,7 @@ const uint8_t tiles_7_data[] = {
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x30, 
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x30, 0x30, 0x30, 0x30};
 
-const uint8_t tiles_8_data[] = {
+static constexpr uint8_t tiles_8_data[] = {
 0x28, 0x30, 0x28, 0x38, 0x30, 0x38, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x38, 
 0x30, 0x28, 0x30, 0x30, 0x28, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
 0x28, 0x28, 0x28, 0x38, 0x30, 0x38, 0x38, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 
@@ -384,7 +272,7 @@ const uint8_t tiles_8_data[] = {
 0x30, 0x28, 0x30, 0x28, 0x30, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7, 
 0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7};
 
-const uint8_t tiles_9_data[] = {
+static constexpr uint8_t tiles_9_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -402,7 +290,7 @@ const uint8_t tiles_9_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t tiles_10_data[] = {
+static constexpr uint8_t tiles_10_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 
@@ -420,7 +308,7 @@ const uint8_t tiles_10_data[] = {
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18};
 
-const uint8_t tiles_11_data[] = {
+static constexpr uint8_t tiles_11_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -438,7 +326,7 @@ const uint8_t tiles_11_data[] = {
 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 
 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00};
 
-const uint8_t tiles_12_data[] = {
+static constexpr uint8_t tiles_12_data[] = {
 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -456,7 +344,7 @@ const uint8_t tiles_12_data[] = {
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00};
 
-const uint8_t tiles_13_data[] = {
+static constexpr uint8_t tiles_13_data[] = {
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
@@ -474,7 +362,7 @@ const uint8_t tiles_13_data[] = {
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18};
 
-const uint8_t tiles_14_data[] = {
+static constexpr uint8_t tiles_14_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
@@ -492,7 +380,7 @@ const uint8_t tiles_14_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7};
 
-const uint8_t tiles_15_data[] = {
+static constexpr uint8_t tiles_15_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -510,7 +398,7 @@ const uint8_t tiles_15_data[] = {
 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t tiles_16_data[] = {
+static constexpr uint8_t tiles_16_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -528,7 +416,7 @@ const uint8_t tiles_16_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38};
 
-const uint8_t tiles_17_data[] = {
+static constexpr uint8_t tiles_17_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -546,7 +434,7 @@ const uint8_t tiles_17_data[] = {
 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38};
 
-const uint8_t tiles_18_data[] = {
+static constexpr uint8_t tiles_18_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -564,7 +452,7 @@ const uint8_t tiles_18_data[] = {
 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t tiles_19_data[] = {
+static constexpr uint8_t tiles_19_data[] = {
 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
@@ -582,7 +470,7 @@ const uint8_t tiles_19_data[] = {
 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_20_data[] = {
+static constexpr uint8_t tiles_20_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -600,7 +488,7 @@ const uint8_t tiles_20_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_21_data[] = {
+static constexpr uint8_t tiles_21_data[] = {
 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
 0x26, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00,
 0x26, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00,
@@ -618,7 +506,7 @@ const uint8_t tiles_21_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_22_data[] = {
+static constexpr uint8_t tiles_22_data[] = {
 0x26, 0x26, 0x26, 0x26, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x26, 0x26, 0x26,
 0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
 0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
@@ -636,7 +524,7 @@ const uint8_t tiles_22_data[] = {
 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_23_data[] = {
+static constexpr uint8_t tiles_23_data[] = {
 0x26, 0x26, 0x26, 0x26, 0x14, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x14, 0x26, 0x26, 0x26, 0x26,
 0x14, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x14, 0x00, 0x26, 0x14, 0x14, 0x0B, 0x26, 0x14, 0x14, 0x14,
 0x14, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x26, 0x14, 0x14, 0x0B, 0x26, 0x14, 0x14, 0x14,
@@ -654,7 +542,7 @@ const uint8_t tiles_23_data[] = {
 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_24_data[] = {
+static constexpr uint8_t tiles_24_data[] = {
 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -672,7 +560,7 @@ const uint8_t tiles_24_data[] = {
 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_25_data[] = {
+static constexpr uint8_t tiles_25_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
@@ -690,7 +578,7 @@ const uint8_t tiles_25_data[] = {
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-const uint8_t tiles_26_data[] = {
+static constexpr uint8_t tiles_26_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
@@ -708,7 +596,7 @@ const uint8_t tiles_26_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t tiles_27_data[] = {
+static constexpr uint8_t tiles_27_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x30, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x30, 0xFF, 0x38, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x30, 0x38, 0x38, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
@@ -726,7 +614,7 @@ const uint8_t tiles_27_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t tiles_28_data[] = {
+static constexpr uint8_t tiles_28_data[] = {
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
@@ -744,38 +632,70 @@ const uint8_t tiles_28_data[] = {
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
-const ImageDesc tiles[] = {
-{16, 16, 8, {.img = tiles_0_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_1_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_2_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_3_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_4_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_5_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_6_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_7_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_8_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_9_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_10_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_11_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_12_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_13_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_14_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_15_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_16_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_17_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_18_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_19_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_20_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_21_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_22_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_23_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_24_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_25_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_26_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_27_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = tiles_28_data}, PALETTE_884, COLOR_MAGENTA}};
-
-const uint8_t gario_0_data[] = {
+// Tiles for the level map, encoded at compile time. Raw arrays above are used
+// by the compiler only.
+static constexpr auto tiles_0_rle = RLE_ENCODE(TILE_SIZE, tiles_0_data, TRANSPARENT_IDX);
+static constexpr auto tiles_1_rle = RLE_ENCODE(TILE_SIZE, tiles_1_data, TRANSPARENT_IDX);
+static constexpr auto tiles_2_rle = RLE_ENCODE(TILE_SIZE, tiles_2_data, TRANSPARENT_IDX);
+static constexpr auto tiles_3_rle = RLE_ENCODE(TILE_SIZE, tiles_3_data, TRANSPARENT_IDX);
+static constexpr auto tiles_4_rle = RLE_ENCODE(TILE_SIZE, tiles_4_data, TRANSPARENT_IDX);
+static constexpr auto tiles_5_rle = RLE_ENCODE(TILE_SIZE, tiles_5_data, TRANSPARENT_IDX);
+static constexpr auto tiles_6_rle = RLE_ENCODE(TILE_SIZE, tiles_6_data, TRANSPARENT_IDX);
+static constexpr auto tiles_7_rle = RLE_ENCODE(TILE_SIZE, tiles_7_data, TRANSPARENT_IDX);
+static constexpr auto tiles_8_rle = RLE_ENCODE(TILE_SIZE, tiles_8_data, TRANSPARENT_IDX);
+static constexpr auto tiles_9_rle = RLE_ENCODE(TILE_SIZE, tiles_9_data, TRANSPARENT_IDX);
+static constexpr auto tiles_10_rle = RLE_ENCODE(TILE_SIZE, tiles_10_data, TRANSPARENT_IDX);
+static constexpr auto tiles_11_rle = RLE_ENCODE(TILE_SIZE, tiles_11_data, TRANSPARENT_IDX);
+static constexpr auto tiles_12_rle = RLE_ENCODE(TILE_SIZE, tiles_12_data, TRANSPARENT_IDX);
+static constexpr auto tiles_13_rle = RLE_ENCODE(TILE_SIZE, tiles_13_data, TRANSPARENT_IDX);
+static constexpr auto tiles_14_rle = RLE_ENCODE(TILE_SIZE, tiles_14_data, TRANSPARENT_IDX);
+static constexpr auto tiles_15_rle = RLE_ENCODE(TILE_SIZE, tiles_15_data, TRANSPARENT_IDX);
+static constexpr auto tiles_16_rle = RLE_ENCODE(TILE_SIZE, tiles_16_data, TRANSPARENT_IDX);
+static constexpr auto tiles_17_rle = RLE_ENCODE(TILE_SIZE, tiles_17_data, TRANSPARENT_IDX);
+static constexpr auto tiles_18_rle = RLE_ENCODE(TILE_SIZE, tiles_18_data, TRANSPARENT_IDX);
+static constexpr auto tiles_19_rle = RLE_ENCODE(TILE_SIZE, tiles_19_data, TRANSPARENT_IDX);
+static constexpr auto tiles_20_rle = RLE_ENCODE(TILE_SIZE, tiles_20_data, TRANSPARENT_IDX);
+static constexpr auto tiles_21_rle = RLE_ENCODE(TILE_SIZE, tiles_21_data, TRANSPARENT_IDX);
+static constexpr auto tiles_22_rle = RLE_ENCODE(TILE_SIZE, tiles_22_data, TRANSPARENT_IDX);
+static constexpr auto tiles_23_rle = RLE_ENCODE(TILE_SIZE, tiles_23_data, TRANSPARENT_IDX);
+static constexpr auto tiles_24_rle = RLE_ENCODE(TILE_SIZE, tiles_24_data, TRANSPARENT_IDX);
+static constexpr auto tiles_25_rle = RLE_ENCODE(TILE_SIZE, tiles_25_data, TRANSPARENT_IDX);
+static constexpr auto tiles_26_rle = RLE_ENCODE(TILE_SIZE, tiles_26_data, TRANSPARENT_IDX);
+static constexpr auto tiles_27_rle = RLE_ENCODE(TILE_SIZE, tiles_27_data, TRANSPARENT_IDX);
+static constexpr auto tiles_28_rle = RLE_ENCODE(TILE_SIZE, tiles_28_data, TRANSPARENT_IDX);
+
+const RleImageDesc tiles[] = {
+{TILE_SIZE, TILE_SIZE, tiles_0_rle.rows, tiles_0_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_1_rle.rows, tiles_1_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_2_rle.rows, tiles_2_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_3_rle.rows, tiles_3_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_4_rle.rows, tiles_4_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_5_rle.rows, tiles_5_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_6_rle.rows, tiles_6_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_7_rle.rows, tiles_7_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_8_rle.rows, tiles_8_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_9_rle.rows, tiles_9_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_10_rle.rows, tiles_10_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_11_rle.rows, tiles_11_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_12_rle.rows, tiles_12_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_13_rle.rows, tiles_13_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_14_rle.rows, tiles_14_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_15_rle.rows, tiles_15_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_16_rle.rows, tiles_16_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_17_rle.rows, tiles_17_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_18_rle.rows, tiles_18_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_19_rle.rows, tiles_19_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_20_rle.rows, tiles_20_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_21_rle.rows, tiles_21_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_22_rle.rows, tiles_22_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_23_rle.rows, tiles_23_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_24_rle.rows, tiles_24_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_25_rle.rows, tiles_25_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_26_rle.rows, tiles_26_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_27_rle.rows, tiles_27_rle.data, PALETTE_884},
+{TILE_SIZE, TILE_SIZE, tiles_28_rle.rows, tiles_28_rle.data, PALETTE_884}};
+
+static constexpr uint8_t gario_0_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -793,7 +713,7 @@ const uint8_t gario_0_data[] = {
 0xC7, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t gario_1_data[] = {
+static constexpr uint8_t gario_1_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -811,7 +731,7 @@ const uint8_t gario_1_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t gario_2_data[] = {
+static constexpr uint8_t gario_2_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
@@ -829,7 +749,7 @@ const uint8_t gario_2_data[] = {
 0xC7, 0x15, 0x15, 0x05, 0x05, 0x05, 0xC7, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t gario_3_data[] = {
+static constexpr uint8_t gario_3_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -847,7 +767,7 @@ const uint8_t gario_3_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t gario_4_data[] = {
+static constexpr uint8_t gario_4_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -865,7 +785,7 @@ const uint8_t gario_4_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t gario_5_data[] = {
+static constexpr uint8_t gario_5_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x6F, 0x6F, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x80, 0x80, 0x80, 0x80, 0xC7, 
@@ -883,7 +803,7 @@ const uint8_t gario_5_data[] = {
 0xC7, 0x15, 0xC7, 0xC7, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t gario_6_data[] = {
+static constexpr uint8_t gario_6_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0x6F, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0x6F, 0xC7, 0xC7, 0xC7, 
@@ -901,16 +821,29 @@ const uint8_t gario_6_data[] = {
 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const ImageDesc gario[] = {
-{16, 16, 8, {.img = gario_0_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = gario_1_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = gario_2_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = gario_3_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = gario_4_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = gario_5_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = gario_6_data}, PALETTE_884, COLOR_MAGENTA}};
-
-const uint8_t mushroom_0_data[] = {
+// Gario frames, encoded at compile time
+static constexpr auto gario_0_rle = RLE_ENCODE(SPRITE_SIZE, gario_0_data, TRANSPARENT_IDX);
+static constexpr auto gario_1_rle = RLE_ENCODE(SPRITE_SIZE, gario_1_data, TRANSPARENT_IDX);
+static constexpr auto gario_2_rle = RLE_ENCODE(SPRITE_SIZE, gario_2_data, TRANSPARENT_IDX);
+static constexpr auto gario_3_rle = RLE_ENCODE(SPRITE_SIZE, gario_3_data, TRANSPARENT_IDX);
+static constexpr auto gario_4_rle = RLE_ENCODE(SPRITE_SIZE, gario_4_data, TRANSPARENT_IDX);
+static constexpr auto gario_5_rle = RLE_ENCODE(SPRITE_SIZE, gario_5_data, TRANSPARENT_IDX);
+static constexpr auto gario_6_rle = RLE_ENCODE(SPRITE_SIZE, gario_6_data, TRANSPARENT_IDX);
+
+const RleImageDesc gario_img[] = {
+{SPRITE_SIZE, SPRITE_SIZE, gario_0_rle.rows, gario_0_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, gario_1_rle.rows, gario_1_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, gario_2_rle.rows, gario_2_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, gario_3_rle.rows, gario_3_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, gario_4_rle.rows, gario_4_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, gario_5_rle.rows, gario_5_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, gario_6_rle.rows, gario_6_rle.data, PALETTE_884}};
+
+// Gario frames prepared for drawing, filled at game start. CPU only data in
+// CCM RAM like level map tile cache.
+static SpriteFrame<SPRITE_SIZE, SPRITE_SIZE> gario[NumberOf(gario_img)] __attribute__((section(".ccmram")));
+
+static constexpr uint8_t mushroom_0_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -928,7 +861,7 @@ const uint8_t mushroom_0_data[] = {
 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7};
 
-const uint8_t mushroom_1_data[] = {
+static constexpr uint8_t mushroom_1_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -946,7 +879,7 @@ const uint8_t mushroom_1_data[] = {
 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const uint8_t mushroom_2_data[] = {
+static constexpr uint8_t mushroom_2_data[] = {
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
@@ -964,10 +897,18 @@ const uint8_t mushroom_2_data[] = {
 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 
 0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7};
 
-const ImageDesc mushroom[] = {
-{16, 16, 8, {.img = mushroom_0_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = mushroom_1_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img = mushroom_2_data}, PALETTE_884, COLOR_MAGENTA}};
+// Enemy frames, encoded at compile time
+static constexpr auto mushroom_0_rle = RLE_ENCODE(SPRITE_SIZE, mushroom_0_data, TRANSPARENT_IDX);
+static constexpr auto mushroom_1_rle = RLE_ENCODE(SPRITE_SIZE, mushroom_1_data, TRANSPARENT_IDX);
+static constexpr auto mushroom_2_rle = RLE_ENCODE(SPRITE_SIZE, mushroom_2_data, TRANSPARENT_IDX);
+
+const RleImageDesc mushroom_img[] = {
+{SPRITE_SIZE, SPRITE_SIZE, mushroom_0_rle.rows, mushroom_0_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, mushroom_1_rle.rows, mushroom_1_rle.data, PALETTE_884},
+{SPRITE_SIZE, SPRITE_SIZE, mushroom_2_rle.rows, mushroom_2_rle.data, PALETTE_884}};
+
+// Enemy frames prepared for drawing, filled at game start
+static SpriteFrame<SPRITE_SIZE, SPRITE_SIZE> mushroom[NumberOf(mushroom_img)] __attribute__((section(".ccmram")));
 
 const uint16_t SuperMarioThemeTable[] = {
 0x2932, 0x2932, 0x0002, 0x2932, 0x0002, 0x20B2, 0x2932, 0x0002, 0x30F2, 0x0002,
@@ -1023,162 +964,85 @@ Gario& Gario::GetInstance(void)
 // *****************************************************************************
 Result Gario::Loop()
 {
-  // Process level data
-  for(uint32_t i = 0; i < sizeof(level_data); i++)
+  // Prepare sprite frames
+  for(uint32_t i = 0U; i < NumberOf(gario); i++)
   {
-    switch(level_data[i])
-    {
-      case 'b':
-        level_data[i] = 1;
-        break;
-      case 'c':
-        level_data[i] = 2;
-        break;
-      case 'd':
-        level_data[i] = 3;
-        break;
-      case 'e':
-        level_data[i] = 4;
-        break;
-      case 'f':
-        level_data[i] = 5;
-        break;
-      case 'g':
-        level_data[i] = 6;
-        break;
-      case 'h':
-        level_data[i] = 7;
-        break;
-      case 'i':
-        level_data[i] = 8;
-        break;
-
-      // Decoration
-      case 'A':
-        level_data[i] = 10;
-        break;
-      case 'B':
-        level_data[i] = 11;
-        break;
-      case 'C':
-        level_data[i] = 12;
-        break;
-      case 'D':
-        level_data[i] = 13;
-        break;
-      case 'E':
-        level_data[i] = 14;
-        break;
-      case 'F':
-        level_data[i] = 15;
-        break;
-      case 'G':
-        level_data[i] = 16;
-        break;
-      case 'H':
-        level_data[i] = 17;
-        break;
-      case 'I':
-        level_data[i] = 18;
-        break;
-      case 'K':
-        level_data[i] = 19;
-        break;
-      case 'L':
-        level_data[i] = 20;
-        break;
-      case 'M':
-        level_data[i] = 21;
-        break;
-      case 'N':
-        level_data[i] = 22;
-        break;
-      case 'O':
-        level_data[i] = 23;
-        break;
-      case 'P':
-        level_data[i] = 24;
-        break;
-      case 'Q':
-        level_data[i] = 25;
-        break;
-
-      case 'j':
-        level_data[i] = 26;
-        break;
-      case 'k':
-        level_data[i] = 27;
-        break;
-
-      case ' ':
-        level_data[i] = 0x1F;
-        break;
-    }
+    gario[i].Init(gario_img[i]);
+  }
+  for(uint32_t i = 0U; i < NumberOf(mushroom); i++)
+  {
+    mushroom[i].Init(mushroom_img[i]);
   }
 
-  // Tile map for world
-  TiledMap tiledmap(0, 0, display_drv.GetScreenW(), levelH * 16,
-                    level_data, levelW, levelH, 0x1F,
+  // Tile map for world. Level data is in flash, LevelMap only reads it.
+  LevelMap tiledmap(0, 0, display_drv.GetScreenW(), levelH * TILE_SIZE,
+                    level.data, levelW, levelH, 0x1F,
                     tiles, NumberOf(tiles), COLOR_BLUE);
   tiledmap.Show(1000);
 
   // Gario sprite
   GarioSprite gario_sprite(10, 10, tiledmap);
 
-  // Enemy sprite
-  EnemySprite enemy_sprite1(300, 10, tiledmap);
-  EnemySprite enemy_sprite2(500, 10, tiledmap);
-  EnemySprite enemy_sprite3(600, 10, tiledmap);
-
-  EnemySprite* enemys[] = {&enemy_sprite1, &enemy_sprite2, &enemy_sprite3};
+  // Enemy sprites pool, sprites shown only for enemies on the screen
+  EnemySprite enemy_sprites[ENEMY_SPRITES_MAX];
+  // Enemies of the level
+  enemy_pool.Init(tiledmap, enemy_sprites, NumberOf(enemy_sprites),
+                  level_enemies, NumberOf(level_enemies));
 
   // Play Sound (Demo)
   sound_drv.PlaySound(SuperMarioThemeTable, NumberOf(SuperMarioThemeTable), 70u, true);
 
+  // Time starts from zero for each game, so recorded input can be replayed
+  time_ms = 0U;
   // Movement variables
   int32_t dx = 0;
   int32_t dy = 0;
-  // Init ticks variable
-  uint32_t last_wake_ticks = RtosTick::GetTickCount();
+  // Fixed timestep loop: slow frame is caught up by few logic steps instead
+  // of delaying all following frames
+  GameLoop game_loop(TICK_MS);
   //Alive flag
   bool alive = true;
+  // Start loop
+  game_loop.Start();
   // Main cycle
   while(alive)
   {
-//    DisplayDrv::GetInstance().InvalidateDisplay();
-    // Update Display
-    DisplayDrv::GetInstance().UpdateDisplay();
-    // Pause until next tick
-    RtosTick::DelayUntilMs(last_wake_ticks, TICK_MS);
-    // Clear variables
-    dx = 0;
-    dy = 0;
-    // Read keyboard
-    if(input_drv.GetButtonState(InputDrv::EXT_LEFT,  InputDrv::BTN_LEFT))  dx = -1;
-    if(input_drv.GetButtonState(InputDrv::EXT_LEFT,  InputDrv::BTN_RIGHT)) dx =  1;
-    if(input_drv.GetButtonState(InputDrv::EXT_RIGHT, InputDrv::BTN_LEFT))  dx *= X_SPEED_MAX;
-    else                                                                   dx *= X_SPEED_MIN;
-
-    if(input_drv.GetButtonState(InputDrv::EXT_RIGHT, InputDrv::BTN_DOWN))  dy = -1;
-    if(input_drv.GetButtonState(InputDrv::EXT_LEFT,  InputDrv::BTN_DOWN))  dy =  1;
-
-    // Process main character sprite
-    alive = gario_sprite.Process(dx, dy, TICK_MS, time_ms);
-    // Process enemy sprites
-    for(uint32_t i = 0; i < NumberOf(enemys); i++)
+    // Replay recorded input as fast as possible
+    game_loop.SetFreeRun(input_log.IsReplay());
+    // Logic steps due at this frame
+    while(alive && game_loop.Update())
     {
-      enemys[i]->Process(dx, dy, TICK_MS, time_ms);
-      // Check collision only if enemy alive
-      if(enemys[i]->IsAlive() && gario_sprite.IsAlive())
+      // Step timestamp for input log
+      input_log.Frame(time_ms);
+      // Clear variables
+      dx = 0;
+      dy = 0;
+      // Read keyboard
+      if(input_log.GetButtonState(InputDrv::EXT_LEFT,  InputDrv::BTN_LEFT))  dx = -1;
+      if(input_log.GetButtonState(InputDrv::EXT_LEFT,  InputDrv::BTN_RIGHT)) dx =  1;
+      if(input_log.GetButtonState(InputDrv::EXT_RIGHT, InputDrv::BTN_LEFT))  dx *= X_SPEED_MAX;
+      else                                                                   dx *= X_SPEED_MIN;
+
+      if(input_log.GetButtonState(InputDrv::EXT_RIGHT, InputDrv::BTN_DOWN))  dy = -1;
+      if(input_log.GetButtonState(InputDrv::EXT_LEFT,  InputDrv::BTN_DOWN))  dy =  1;
+
+      // Process main character sprite
+      alive = gario_sprite.Process(dx, dy, TICK_MS, time_ms);
+      // Process enemies
+      enemy_pool.Process(TICK_MS, time_ms);
+      // Check collision only if Gario alive
+      if(gario_sprite.IsAlive())
       {
-        if((gario_sprite.GetEndX() >= enemys[i]->GetStartX()) &&
-           (gario_sprite.GetStartX() <= enemys[i]->GetEndX()) &&
-           (gario_sprite.GetEndY() >= enemys[i]->GetStartY()) &&
-           (gario_sprite.GetStartY() <= enemys[i]->GetEndY()) )
+        // Gario position in the tilemap
+        int32_t x = gario_sprite.GetStartX() + tiledmap.GetMapPosX();
+        int32_t y = gario_sprite.GetStartY() + tiledmap.GetMapPosY();
+        // Find enemy touched by Gario
+        int32_t idx = enemy_pool.FindContact(x, y, gario_sprite.GetWidth(), gario_sprite.GetHeight());
+        if(idx >= 0)
         {
-          if(gario_sprite.GetEndY() == enemys[i]->GetStartY())
+          if(y + gario_sprite.GetHeight() - 1 == enemy_pool.GetY(idx))
           {
-            enemys[i]->Die();
+            enemy_pool.Die(idx);
             gario_sprite.Jump();
           }
           else
@@ -1187,13 +1051,16 @@ Result Gario::Loop()
             gario_sprite.Die();
             gario_sprite.Jump();
           }
-          break;
         }
       }
-    }
 
-    // Increase tick counter
-    time_ms += TICK_MS;
+      // Increase tick counter
+      time_ms += TICK_MS;
+    }
+    // Update Display
+    game_loop.Render();
+    // Pause until next tick
+    game_loop.Wait();
   }
 
   // Stop Sound
@@ -1203,11 +1070,182 @@ Result Gario::Loop()
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   SweepTiles   **********************************************************
+// *****************************************************************************
+// * Sweep probe coordinate from "pos" in direction "dir" up to "dist" pixels.
+// * Returns number of pixels sprite can move before probe reach position
+// * where "is_free" returns false. If returned value less than "dist" - sprite
+// * has contact in "dir" direction. Level data is the same for all pixels in
+// * the tile, so "is_free" is called once per tile instead of once per pixel.
+// * Result is the same as moving by one pixel and check probe at each step.
+template<typename T> static int32_t SweepTiles(int32_t pos, int32_t dir, int32_t dist, T is_free)
+{
+  int32_t moved = 0;
+  while((moved < dist) && is_free(pos + dir * moved))
+  {
+    // Current probe position
+    int32_t probe = pos + dir * moved;
+    // Skip all pixels of the current tile in move direction
+    moved += 1 + ((dir > 0) ? (TILE_SIZE - 1 - probe % TILE_SIZE) : (probe % TILE_SIZE));
+  }
+  // Sprite can't move more than requested
+  return (moved < dist) ? moved : dist;
+}
+
+// *****************************************************************************
+// ***   SweepTilesX   *********************************************************
+// *****************************************************************************
+// * Returns X movement of sprite with size "w" x "h" at position "x", "y" in
+// * the tile map to "dx" pixels. Tiles on the left or right side of sprite top
+// * and bottom lines have to be passable.
+static int32_t SweepTilesX(LevelMap& map, int32_t x, int32_t y, int32_t w, int32_t h, int32_t dx)
+{
+  int32_t moved = 0;
+  // Probe tiles on the side of sprite
+  auto is_free = [&](int32_t px)
+  {
+    return (map.GetLvlDataByXY(px, y) >= TILE_PASSABLE_IDX)
+        && (map.GetLvlDataByXY(px, y + h) >= TILE_PASSABLE_IDX);
+  };
+  // Move to the left
+  if(dx < 0)
+  {
+    moved = -SweepTiles(x - 1, -1, -dx, is_free);
+  }
+  // Move to the right
+  else if(dx > 0)
+  {
+    moved = SweepTiles(x + w + 1, 1, dx, is_free);
+  }
+  return moved;
+}
+
+// *****************************************************************************
+// ***   LevelMap   ************************************************************
+// *****************************************************************************
+// Tile cache is in CCM RAM: it is read by CPU only(DMA can't access CCM RAM)
+// and doesn't take main RAM. Startup code doesn't clear this section, cache
+// is filled by the constructor.
+color_t LevelMap::tile_cache[TILES_MAX + 1][TILE_SIZE * TILE_SIZE] __attribute__((section(".ccmram")));
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+LevelMap::LevelMap(int32_t x, int32_t y, int32_t w, int32_t h,
+                   const uint8_t* map_t, int32_t map_w_t, int32_t map_h_t, uint8_t empty_tile_t,
+                   const RleImageDesc* tiles_t, int32_t tiles_cnt_t, color_t bg_color_t)
+{
+  map = map_t;
+  map_w = map_w_t;
+  map_h = map_h_t;
+  empty_tile = empty_tile_t;
+  tiles_cnt = (tiles_cnt_t < TILES_MAX) ? tiles_cnt_t : TILES_MAX;
+  bg_color = bg_color_t;
+  // Object area
+  x_start = x;
+  y_start = y;
+  x_end = x + w - 1;
+  y_end = y + h - 1;
+  width = w;
+  height = h;
+
+  // Convert tiles to color_t. Map is drawn under all other objects, so
+  // transparent pixels are stored as background color and every tile row
+  // can be copied as is.
+  for(int32_t t = 0; t < tiles_cnt; t++)
+  {
+    RleDecode(tiles_t[t], tile_cache[t], bg_color);
+  }
+  // Empty space
+  for(int32_t i = 0; i < TILE_SIZE * TILE_SIZE; i++)
+  {
+    tile_cache[TILES_MAX][i] = bg_color;
+  }
+}
+
+// *****************************************************************************
+// ***   GetLvlIdxByXY   *******************************************************
+// *****************************************************************************
+int32_t LevelMap::GetLvlIdxByXY(int32_t x, int32_t y)
+{
+  int32_t idx = -1;
+  if((x >= 0) && (y >= 0) && (x < map_w * TILE_SIZE) && (y < map_h * TILE_SIZE))
+  {
+    idx = (y / TILE_SIZE) * map_w + (x / TILE_SIZE);
+  }
+  return idx;
+}
+
+// *****************************************************************************
+// ***   GetLvlDataByXY   ******************************************************
+// *****************************************************************************
+int32_t LevelMap::GetLvlDataByXY(int32_t x, int32_t y)
+{
+  int32_t idx = GetLvlIdxByXY(x, y);
+  return (idx >= 0) ? map[idx] : empty_tile;
+}
+
+// *****************************************************************************
+// ***   ScrollView   **********************************************************
+// *****************************************************************************
+void LevelMap::ScrollView(int32_t dx, int32_t dy)
+{
+  int32_t x = map_pos_x + dx;
+  int32_t y = map_pos_y + dy;
+  // View can't be out of the map
+  if(x > map_w * TILE_SIZE - width) x = map_w * TILE_SIZE - width;
+  if(y > map_h * TILE_SIZE - height) y = map_h * TILE_SIZE - height;
+  if(x < 0) x = 0;
+  if(y < 0) y = 0;
+  // Redraw whole view only if it scrolled
+  if((x != map_pos_x) || (y != map_pos_y))
+  {
+    map_pos_x = x;
+    map_pos_y = y;
+    InvalidateObjArea();
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void LevelMap::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    // Line in the map
+    int32_t map_y = line - y_start + map_pos_y;
+    // Tiles row and line in the tiles
+    const uint8_t* map_row = &map[(map_y / TILE_SIZE) * map_w];
+    int32_t tile_line = (map_y % TILE_SIZE) * TILE_SIZE;
+    // Part of the object in the buffer
+    int32_t start = (x_start > start_x) ? x_start : start_x;
+    int32_t end = (x_end < start_x + n - 1) ? x_end : start_x + n - 1;
+    // Draw line tile by tile
+    for(int32_t x = start; x <= end;)
+    {
+      int32_t map_x = x - x_start + map_pos_x;
+      // Pixels of current tile in the line
+      int32_t tile_x = map_x % TILE_SIZE;
+      int32_t cnt = TILE_SIZE - tile_x;
+      if(cnt > end - x + 1) cnt = end - x + 1;
+      // Tile index, tile without image is empty space
+      int32_t tile = map_row[map_x / TILE_SIZE];
+      if(tile >= tiles_cnt) tile = TILES_MAX;
+      // Copy tile row
+      memcpy(&buf[x - start_x], &tile_cache[tile][tile_line + tile_x], cnt * sizeof(color_t));
+      x += cnt;
+    }
+  }
+}
+
 // *****************************************************************************
 // ***   Constructor   *********************************************************
 // *****************************************************************************
-GarioSprite::GarioSprite(int32_t x, int32_t y, TiledMap& tiled_map_t) :
-                                                          Image(x, y, gario[1]),
+GarioSprite::GarioSprite(int32_t x, int32_t y, LevelMap& tiled_map_t) :
+                               Sprite<SPRITE_SIZE, SPRITE_SIZE>(x, y, gario[1]),
                                                            tile_map(tiled_map_t)
 {
   x_map_pos = x;
@@ -1280,55 +1318,58 @@ bool GarioSprite::Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_
   int32_t y_end_pos = y_map_pos + (y_speed_rest + y_speed)/1000000;
   // Calculate speed rest for next iteration 
   y_speed_rest = (y_speed_rest + y_speed)%1000000;
-  // Y axis movement - cycle for accuracy
-  while((y_map_pos != y_end_pos) && alive)
+  // Y axis movement
+  if(y_end_pos > y_map_pos)
   {
-    // If possible move to the up
-    if(   (y_speed > 0)
-       && (tile_map.GetLvlIdxByXY(x_map_pos, y_map_pos + GetHeight() + 1) == -1)
-       && (tile_map.GetLvlIdxByXY(x_map_pos + GetWidth(), y_map_pos + GetHeight() + 1) == -1) )
+    // Probe line under the sprite
+    int32_t probe = y_map_pos + GetHeight() + 1;
+    // Move down while sprite in the map and tiles under it are passable
+    int32_t moved = SweepTiles(probe, 1, y_end_pos - y_map_pos, [&](int32_t py)
     {
-      alive = false;
-    }
-    else if ((y_speed > 0) && (is_die))
-    {
-      y_map_pos++;
-    }
-    else if(   (y_speed > 0)
-            && (tile_map.GetLvlDataByXY(x_map_pos, y_map_pos + GetHeight() + 1) >= 10)
-            && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth(), y_map_pos + GetHeight() + 1) >= 10))
-    {
-      y_map_pos++;
-    }
-    // If possible move to the down
-    else if(y_speed < 0)
+      return (   (tile_map.GetLvlIdxByXY(x_map_pos, py) != -1)
+              || (tile_map.GetLvlIdxByXY(x_map_pos + GetWidth(), py) != -1) )
+          && (   is_die
+              || (   (tile_map.GetLvlDataByXY(x_map_pos, py) >= TILE_PASSABLE_IDX)
+                  && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth(), py) >= TILE_PASSABLE_IDX) ) );
+    });
+    y_map_pos += moved;
+    // Bottom contact
+    if(y_map_pos != y_end_pos)
     {
-      if(   (y_map_pos > 0)
-         && (tile_map.GetLvlDataByXY(x_map_pos, y_map_pos - 1) >= 10)
-         && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth(), y_map_pos - 1) >= 10) )
+      probe += moved;
+      // If sprite fall out of the map
+      if(   (tile_map.GetLvlIdxByXY(x_map_pos, probe) == -1)
+         && (tile_map.GetLvlIdxByXY(x_map_pos + GetWidth(), probe) == -1) )
       {
-        y_map_pos--;
+        alive = false;
       }
       else
       {
-        // When we reach any block - reset speed
-        y_speed = 10;
+        // When we reach down - reset speed
+        y_speed = 0;
         // Clear speed rest
         y_speed_rest = 0;
-        // Clear jump flag
-        jump = false;
-        // Exit from cycle
-        break;
       }
     }
-    else
+  }
+  else if(y_end_pos < y_map_pos)
+  {
+    // Move up while tiles above sprite are passable
+    y_map_pos -= SweepTiles(y_map_pos - 1, -1, y_map_pos - y_end_pos, [&](int32_t py)
     {
-      // When we reach down - reset speed
-      y_speed = 0;
+      return (py >= 0)
+          && (tile_map.GetLvlDataByXY(x_map_pos, py) >= TILE_PASSABLE_IDX)
+          && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth(), py) >= TILE_PASSABLE_IDX);
+    });
+    // Top contact
+    if(y_map_pos != y_end_pos)
+    {
+      // When we reach any block - reset speed
+      y_speed = 10;
       // Clear speed rest
       y_speed_rest = 0;
-      // Exit from cycle
-      break;
+      // Clear jump flag
+      jump = false;
     }
   }
 
@@ -1342,32 +1383,10 @@ bool GarioSprite::Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_
   x_speed_rest = (x_speed_rest + x_speed)%1000;
   // We can't move behind map
   if(x_end_pos < 0) x_end_pos = 0;
-  // X axis movement - cycle for accuracy
-  while((x_map_pos != x_end_pos) && (is_die == false))
+  // X axis movement
+  if(is_die == false)
   {
-    // If possible move to the left
-    if(   (dx < 0)
-       && (tile_map.GetLvlDataByXY(x_map_pos-1, y_map_pos) >= 10)
-       && (tile_map.GetLvlDataByXY(x_map_pos-1, y_map_pos + GetHeight()) >= 10) )
-    {
-      // Decrease position
-      x_map_pos--;
-      // Call check enemys here
-    }
-    // If possible move to the right
-    else if(   (dx > 0)
-            && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth() + 1, y_map_pos) >= 10)
-            && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth() + 1, y_map_pos + GetHeight()) >= 10) )
-    {
-      // Increase position
-      x_map_pos++;
-      // Call check enemies here
-    }
-    else
-    {
-      // Otherwise exit from cycle
-      break;
-    }
+    x_map_pos += SweepTilesX(tile_map, x_map_pos, y_map_pos, GetWidth(), GetHeight(), x_end_pos - x_map_pos);
   }
   // If Gario can't move - clear X speed
   if(x_map_pos != x_end_pos)
@@ -1399,124 +1418,365 @@ bool GarioSprite::Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_
 // *****************************************************************************
 // ***   Constructor   *********************************************************
 // *****************************************************************************
-EnemySprite::EnemySprite(int32_t x, int32_t y, TiledMap& tiled_map_t) :
-                                                       Image(x, y, mushroom[0]),
-                                                           tile_map(tiled_map_t)
+EnemySprite::EnemySprite() : Sprite<SPRITE_SIZE, SPRITE_SIZE>(0, 0, mushroom[0])
 {
-  x_map_pos = x;
-  y_map_pos = y;
-  Show(1009);
+  // Sprite shown by EnemyPool when it assigned to enemy
+}
+
+// *****************************************************************************
+// ***   Init   ****************************************************************
+// *****************************************************************************
+void EnemyPool::Init(LevelMap& tiled_map_t, EnemySprite* sprites_t, int32_t sprites_cnt_t,
+                     const EnemySpawn* spawn, int32_t spawn_cnt)
+{
+  // Save tile map
+  tile_map = &tiled_map_t;
+  // Save sprites pool
+  sprites = sprites_t;
+  sprites_cnt = (sprites_cnt_t < ENEMY_SPRITES_MAX) ? sprites_cnt_t : ENEMY_SPRITES_MAX;
+  // All sprites are free
+  for(int32_t i = 0; i < sprites_cnt; i++)
+  {
+    sprite_owner[i] = -1;
+  }
+  // All enemies have the same size
+  width = sprites[0].GetWidth();
+  height = sprites[0].GetHeight();
+  // Reset animation
+  move_idx = 0;
+
+  // Populate enemies from spawn points
+  enemies_cnt = (spawn_cnt < ENEMIES_MAX) ? spawn_cnt : ENEMIES_MAX;
+  for(int32_t i = 0; i < enemies_cnt; i++)
+  {
+    x_map_pos[i] = spawn[i].x;
+    y_map_pos[i] = spawn[i].y;
+    x_speed[i] = -X_SPEED_MIN/2;
+    x_speed_rest[i] = 0;
+    y_speed[i] = 0;
+    y_speed_rest[i] = 0;
+    time_to_die[i] = 0;
+    sprite[i] = -1;
+    state[i] = ENEMY_SLEEP;
+  }
+  // No active enemies yet
+  next_idx = 0;
+  active_cnt = 0;
 }
 
 // *****************************************************************************
 // ***   Process   *************************************************************
 // *****************************************************************************
-void EnemySprite::Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_ms)
+void EnemyPool::Process(int32_t tick_ms, int32_t time_ms)
 {
-  if(is_active)
+  // ***   Wake up enemies came in view   **************************************
+  int32_t view_end = tile_map->GetMapPosX() + (int32_t)DisplayDrv::GetInstance().GetScreenW();
+  while((next_idx < enemies_cnt) && (x_map_pos[next_idx] <= view_end))
   {
-    // ***   Visual effects   **************************************************
-    if(time_ms%(X_SPRITE_ANIM_SPEED*2) == 0) SetImage(mushroom[move_idx++]);
+    state[next_idx] = ENEMY_WALK;
+    active[active_cnt++] = next_idx;
+    next_idx++;
+  }
+
+  // ***   Visual effects   ****************************************************
+  bool anim = (time_ms%(X_SPRITE_ANIM_SPEED*2) == 0);
+  if(anim)
+  {
+    move_idx++;
     // Check animation variable
     if(move_idx >= 2) move_idx = 0;
+  }
 
-    // ***   Y movement   ******************************************************
-    // Increase speed
-    y_speed += Y_ACCEL_CONST;
-    // Find new Y position in pixels
-    int32_t y_end_pos = y_map_pos + (y_speed_rest + y_speed)/1000000;
-    // Calculate speed rest for next iteration 
-    y_speed_rest = (y_speed_rest + y_speed)%1000000;
-    // Y axis movement - cycle for accuracy
-    while(y_map_pos != y_end_pos)
-    {
-      // If possible move to the up
-      if(   (tile_map.GetLvlDataByXY(x_map_pos, y_map_pos + GetHeight() + 1) >= 10)
-         && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth(), y_map_pos + GetHeight() + 1) >= 10))
-      {
-        y_map_pos++;
-      }
-      else
-      {
-        // When we reach down - reset speed
-        y_speed = 0;
-        // Clear speed rest
-        y_speed_rest = 0;
-        // Exit from cycle
-        break;
-      }
-    }
+  // ***   Enemies movement   **************************************************
+  for(int32_t i = 0; i < active_cnt; i++)
+  {
+    MoveEnemy(active[i], tick_ms);
+  }
 
-    // If died
-    if(is_die)
-    { // Show smashed
-      SetImage(mushroom[2]);
-      // Decrease time counter
-      time_to_die -= tick_ms;
-      // If time expired
-      if(time_to_die < 0)
-      {
-        // Hide sprite
-        Hide();
-        // Set inactive
-        is_active = false;
-      }
+  // ***   Enemy to enemy contacts   *******************************************
+  BuildGrid();
+  ProcessContacts();
+
+  // ***   Enemy sprites   *****************************************************
+  for(int32_t i = 0; i < active_cnt;)
+  {
+    int32_t idx = active[i];
+    UpdateSprite(idx, anim);
+    // Remove gone enemy from active list
+    if(state[idx] == ENEMY_GONE)
+    {
+      active[i] = active[--active_cnt];
     }
     else
     {
-      // ***   X movement   ******************************************************
-      // Calculate x movement
-      int32_t x_end_pos = x_map_pos + (x_speed_rest + x_speed)/1000;
-      // Calculate rest for next cycle
-      x_speed_rest = (x_speed_rest + x_speed)%1000;
-      // We can't move behind map
-      if(x_end_pos < 0) x_end_pos = 0;
-      // X axis movement - cycle for accuracy
-      while(x_map_pos != x_end_pos)
+      i++;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   FindContact   *********************************************************
+// *****************************************************************************
+int32_t EnemyPool::FindContact(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  int32_t result = -1;
+  // Enemies placed in the cell by top left corner, so enemies overlapping area
+  // can be in the cells from one cell to the left/up of area to its end
+  for(int32_t cy = GetCellY(y - GRID_CELL_SIZE); cy <= GetCellY(y + h - 1); cy++)
+  {
+    for(int32_t cx = GetCellX(x - GRID_CELL_SIZE); cx <= GetCellX(x + w - 1); cx++)
+    {
+      int32_t cell = cy * GRID_W + cx;
+      for(int32_t k = cell_start[cell]; k < cell_start[cell + 1]; k++)
       {
-        // If possible move to the left
-        if(   (x_speed < 0)
-           && (tile_map.GetLvlDataByXY(x_map_pos-1, y_map_pos) >= 10)
-           && (tile_map.GetLvlDataByXY(x_map_pos-1, y_map_pos + GetHeight()) >= 10) )
-        {
-          // Decrease position
-          x_map_pos--;
-          // Call check enemys here
-        }
-        // If possible move to the right
-        else if(   (x_speed > 0)
-                && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth() + 1, y_map_pos) >= 10)
-                && (tile_map.GetLvlDataByXY(x_map_pos + GetWidth() + 1, y_map_pos + GetHeight()) >= 10) )
+        int32_t idx = cell_items[k];
+        // Enemy can be smashed or gone after grid was built. Enemy without
+        // sprite isn't on the screen when sprite pool is exhausted.
+        if(   (state[idx] == ENEMY_WALK) && (sprite[idx] >= 0)
+           && (x + w - 1 >= x_map_pos[idx]) && (x <= x_map_pos[idx] + width - 1)
+           && (y + h - 1 >= y_map_pos[idx]) && (y <= y_map_pos[idx] + height - 1)
+           && ((result < 0) || (idx < result)) )
         {
-          // Increase position
-          x_map_pos++;
-          // Call check enemies here
+          result = idx;
         }
-        else
-        {
-          // Otherwise exit from cycle
-          break;
-        }
-      }
-      // If Enemy can't move - invert X speed
-      if(x_map_pos != x_end_pos)
-      {
-        x_speed = -x_speed;
-        x_speed_rest = 0;
       }
     }
+  }
+  return result;
+}
 
-    // ***   Enemy sprite movement   *******************************************
-    Move(x_map_pos - tile_map.GetMapPosX(), y_map_pos - tile_map.GetMapPosY());
+// *****************************************************************************
+// ***   Die   *****************************************************************
+// *****************************************************************************
+void EnemyPool::Die(int32_t idx)
+{
+  state[idx] = ENEMY_DIE;
+  time_to_die[idx] = 2000;
+  // Show smashed
+  if(sprite[idx] >= 0)
+  {
+    sprites[sprite[idx]].SetImage(mushroom[2]);
+  }
+}
 
-    // ***   Enemy gone when out screen sprite movement   **********************
-    if(GetEndX() < 0) is_active = false;
+// *****************************************************************************
+// ***   Private: MoveEnemy   **************************************************
+// *****************************************************************************
+void EnemyPool::MoveEnemy(int32_t idx, int32_t tick_ms)
+{
+  // ***   Y movement   ********************************************************
+  // Increase speed
+  y_speed[idx] += Y_ACCEL_CONST;
+  // Find new Y position in pixels
+  int32_t y_end_pos = y_map_pos[idx] + (y_speed_rest[idx] + y_speed[idx])/1000000;
+  // Calculate speed rest for next iteration
+  y_speed_rest[idx] = (y_speed_rest[idx] + y_speed[idx])%1000000;
+  // Y axis movement
+  if(y_end_pos > y_map_pos[idx])
+  {
+    int32_t x = x_map_pos[idx];
+    // Move down while tiles under sprite are passable
+    y_map_pos[idx] += SweepTiles(y_map_pos[idx] + height + 1, 1, y_end_pos - y_map_pos[idx], [&](int32_t py)
+    {
+      return (tile_map->GetLvlDataByXY(x, py) >= TILE_PASSABLE_IDX)
+          && (tile_map->GetLvlDataByXY(x + width, py) >= TILE_PASSABLE_IDX);
+    });
+    // Bottom contact
+    if(y_map_pos[idx] != y_end_pos)
+    {
+      // When we reach down - reset speed
+      y_speed[idx] = 0;
+      // Clear speed rest
+      y_speed_rest[idx] = 0;
+    }
+  }
+
+  // If died
+  if(state[idx] == ENEMY_DIE)
+  {
+    // Decrease time counter
+    time_to_die[idx] -= tick_ms;
+    // If time expired - enemy gone
+    if(time_to_die[idx] < 0) state[idx] = ENEMY_GONE;
   }
   else
   {
-    if(tile_map.GetMapPosX() + (int32_t)DisplayDrv::GetInstance().GetScreenW() >= x_map_pos)
+    // ***   X movement   ******************************************************
+    // Calculate x movement
+    int32_t x_end_pos = x_map_pos[idx] + (x_speed_rest[idx] + x_speed[idx])/1000;
+    // Calculate rest for next cycle
+    x_speed_rest[idx] = (x_speed_rest[idx] + x_speed[idx])%1000;
+    // We can't move behind map
+    if(x_end_pos < 0) x_end_pos = 0;
+    // X axis movement
+    x_map_pos[idx] += SweepTilesX(*tile_map, x_map_pos[idx], y_map_pos[idx], width, height, x_end_pos - x_map_pos[idx]);
+    // If Enemy can't move - invert X speed
+    if(x_map_pos[idx] != x_end_pos)
     {
-      is_active = true;
+      x_speed[idx] = -x_speed[idx];
+      x_speed_rest[idx] = 0;
     }
   }
+
+  // ***   Enemy gone when out of screen or fall out of map   ******************
+  if(   (x_map_pos[idx] + width <= tile_map->GetMapPosX())
+     || (y_map_pos[idx] >= tile_map->GetHeight()) )
+  {
+    state[idx] = ENEMY_GONE;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: UpdateSprite   ***********************************************
+// *****************************************************************************
+void EnemyPool::UpdateSprite(int32_t idx, bool anim)
+{
+  // Enemy position on the screen
+  int32_t x = x_map_pos[idx] - tile_map->GetMapPosX();
+  int32_t y = y_map_pos[idx] - tile_map->GetMapPosY();
+  // Check if enemy visible
+  bool visible =    (state[idx] != ENEMY_GONE) && (x + width > 0)
+                 && (x < (int32_t)DisplayDrv::GetInstance().GetScreenW());
+  // Sprite index
+  int32_t spr = sprite[idx];
+
+  if(visible && (spr < 0))
+  {
+    // Find free sprite
+    for(spr = 0; (spr < sprites_cnt) && (sprite_owner[spr] >= 0); spr++);
+    // If there is no free sprite, enemy will be shown when one is released
+    if(spr < sprites_cnt)
+    {
+      sprite_owner[spr] = idx;
+      sprite[idx] = spr;
+      sprites[spr].SetImage((state[idx] == ENEMY_DIE) ? mushroom[2] : mushroom[move_idx]);
+      sprites[spr].Move(x, y);
+      sprites[spr].Show(1009);
+    }
+  }
+  else if(!visible && (spr >= 0))
+  {
+    // Release sprite
+    sprites[spr].Hide();
+    sprite_owner[spr] = -1;
+    sprite[idx] = -1;
+  }
+  else if(spr >= 0)
+  {
+    // Walk animation
+    if(anim && (state[idx] == ENEMY_WALK)) sprites[spr].SetImage(mushroom[move_idx]);
+    // ***   Enemy sprite movement   *******************************************
+    sprites[spr].Move(x, y);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: BuildGrid   **************************************************
+// *****************************************************************************
+void EnemyPool::BuildGrid()
+{
+  static const int32_t GRID_CELLS = GRID_W * GRID_H;
+  // Clear counters
+  for(int32_t c = 0; c <= GRID_CELLS; c++)
+  {
+    cell_start[c] = 0U;
+  }
+  // Count walking enemies in each cell
+  for(int32_t i = 0; i < active_cnt; i++)
+  {
+    int32_t idx = active[i];
+    if(state[idx] == ENEMY_WALK)
+    {
+      active_cell[i] = GetCellY(y_map_pos[idx]) * GRID_W + GetCellX(x_map_pos[idx]);
+      cell_start[active_cell[i] + 1U]++;
+    }
+  }
+  // Find start of each cell
+  for(int32_t c = 0; c < GRID_CELLS; c++)
+  {
+    cell_start[c + 1] += cell_start[c];
+  }
+  // Put enemies to cells. Start of each cell moved to start of the next one.
+  for(int32_t i = 0; i < active_cnt; i++)
+  {
+    if(state[active[i]] == ENEMY_WALK)
+    {
+      cell_items[cell_start[active_cell[i]]++] = active[i];
+    }
+  }
+  // Restore cell starts
+  for(int32_t c = GRID_CELLS; c > 0; c--)
+  {
+    cell_start[c] = cell_start[c - 1];
+  }
+  cell_start[0] = 0U;
+}
+
+// *****************************************************************************
+// ***   Private: ProcessContacts   ********************************************
+// *****************************************************************************
+void EnemyPool::ProcessContacts()
+{
+  for(int32_t i = 0; i < active_cnt; i++)
+  {
+    int32_t idx = active[i];
+    if(state[idx] == ENEMY_WALK)
+    {
+      int32_t x = x_map_pos[idx];
+      int32_t y = y_map_pos[idx];
+      for(int32_t cy = GetCellY(y - GRID_CELL_SIZE); cy <= GetCellY(y + height - 1); cy++)
+      {
+        for(int32_t cx = GetCellX(x - GRID_CELL_SIZE); cx <= GetCellX(x + width - 1); cx++)
+        {
+          int32_t cell = cy * GRID_W + cx;
+          for(int32_t k = cell_start[cell]; k < cell_start[cell + 1]; k++)
+          {
+            int32_t j = cell_items[k];
+            // Check each pair once
+            if(   (j > idx) && (x != x_map_pos[j])
+               && (x + width - 1 >= x_map_pos[j]) && (x <= x_map_pos[j] + width - 1)
+               && (y + height - 1 >= y_map_pos[j]) && (y <= y_map_pos[j] + height - 1) )
+            {
+              // Enemies bump into each other - turn them back
+              int32_t left  = (x < x_map_pos[j]) ? idx : j;
+              int32_t right = (x < x_map_pos[j]) ? j : idx;
+              if(x_speed[left] > 0)
+              {
+                x_speed[left] = -x_speed[left];
+                x_speed_rest[left] = 0;
+              }
+              if(x_speed[right] < 0)
+              {
+                x_speed[right] = -x_speed[right];
+                x_speed_rest[right] = 0;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: GetCellX   ***************************************************
+// *****************************************************************************
+int32_t EnemyPool::GetCellX(int32_t x)
+{
+  // Grid starts one cell left of the screen
+  int32_t cx = (x - tile_map->GetMapPosX() + GRID_CELL_SIZE) / GRID_CELL_SIZE;
+  if(cx < 0) cx = 0;
+  if(cx >= GRID_W) cx = GRID_W - 1;
+  return cx;
+}
+
+// *****************************************************************************
+// ***   Private: GetCellY   ***************************************************
+// *****************************************************************************
+int32_t EnemyPool::GetCellY(int32_t y)
+{
+  int32_t cy = y / GRID_CELL_SIZE;
+  if(cy < 0) cy = 0;
+  if(cy >= GRID_H) cy = GRID_H - 1;
+  return cy;
 }
@@ -15,6 +15,10 @@
 #include "InputDrv.h"
 #include "SoundDrv.h"
 #include "UiEngine.h"
+#include "GameLoop.h"
+#include "InputLog.h"
+#include "RleImage.h"
+#include "Sprite.h"
 
 // *****************************************************************************
 // ***   Local const variables   ***********************************************
@@ -38,116 +42,321 @@ static const int32_t X_SPEED_MAX = X_SPEED_MAX_S * TICK_MS;
 // Animation speed should be divisible by TICK_MS
 static const int32_t X_SPRITE_ANIM_SPEED = (100 / TICK_MS) * TICK_MS;
 
+// Tile size in pixels
+static const int32_t TILE_SIZE = 16;
+// Tiles with index less than this value are solid
+static const int32_t TILE_PASSABLE_IDX = 10;
+// Gario and enemy sprite size in pixels
+static const int32_t SPRITE_SIZE = 16;
+
+// Max number of enemy sprites on the screen at the same time
+static const int32_t ENEMY_SPRITES_MAX = 8;
+// Broadphase grid cell size in pixels. Can't be less than enemy sprite size.
+static const int32_t GRID_CELL_SIZE = 32;
+// Broadphase grid size in cells. Grid starts one cell left of the screen,
+// enemies outside of it are placed in the border cells.
+static const int32_t GRID_W = 16;
+static const int32_t GRID_H = 8;
+
 // *****************************************************************************
 // ***   Defines   *************************************************************
 // *****************************************************************************
 #define BG_Z (100)
 
 // *****************************************************************************
-// ***   Application Class   ***************************************************
+// ***   Level Map Class   *****************************************************
 // *****************************************************************************
-class Gario : public AppTask
+// * Tiled map of the level. Tiles are converted from RLE images to color_t
+// * when map is created, so each tile row in a scrolled line is drawn
+// * by one copy instead of palette lookup and transparency check per pixel.
+class LevelMap : public VisObject
 {
   public:
     // *************************************************************************
-    // ***   Get Instance   ****************************************************
+    // ***   Constructor   *****************************************************
     // *************************************************************************
-    static Gario& GetInstance(void);
+    // * map_t        - tile index for each tile of the map, row by row
+    // * empty_tile_t - tile index of empty space, returned for positions out
+    // *                of the map too
+    // * tiles_t      - TILE_SIZE x TILE_SIZE RLE images, tile index greater
+    // *                or equal to tiles_cnt_t is drawn with background color
+    // * Transparent pixels of tiles are drawn with background color.
+    LevelMap(int32_t x, int32_t y, int32_t w, int32_t h,
+             const uint8_t* map_t, int32_t map_w_t, int32_t map_h_t, uint8_t empty_tile_t,
+             const RleImageDesc* tiles_t, int32_t tiles_cnt_t, color_t bg_color_t);
 
     // *************************************************************************
-    // ***   Application Loop   ************************************************
+    // ***   Get tile index in the map by position in pixels   *****************
     // *************************************************************************
-    virtual Result Loop();
+    // * Returns -1 if position is out of the map.
+    int32_t GetLvlIdxByXY(int32_t x, int32_t y);
 
-  private:
-    // Display driver instance
-    DisplayDrv& display_drv = DisplayDrv::GetInstance();
-    // Input driver instance
-    InputDrv& input_drv = InputDrv::GetInstance();
-    // Sound driver instance
-    SoundDrv& sound_drv = SoundDrv::GetInstance();
+    // *************************************************************************
+    // ***   Get tile by position in pixels   **********************************
+    // *************************************************************************
+    int32_t GetLvlDataByXY(int32_t x, int32_t y);
 
-    // Time variable
-    uint32_t time_ms = 0U;
+    // *************************************************************************
+    // ***   Get position of the view in the map   *****************************
+    // *************************************************************************
+    int32_t GetMapPosX(void) const {return map_pos_x;}
+    int32_t GetMapPosY(void) const {return map_pos_y;}
 
     // *************************************************************************
-    // ***   Private constructor   *********************************************
+    // ***   Get map size in pixels   ******************************************
     // *************************************************************************
-    Gario() : AppTask(APPLICATION_TASK_STACK_SIZE, APPLICATION_TASK_PRIORITY,
-                      "Gario") {};
+    int32_t GetPixWidth(void) const {return map_w * TILE_SIZE;}
+    int32_t GetPixHeight(void) const {return map_h * TILE_SIZE;}
+
+    // *************************************************************************
+    // ***   Scroll view   *****************************************************
+    // *************************************************************************
+    // * View can't be scrolled out of the map.
+    void ScrollView(int32_t dx, int32_t dy = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y) {};
+
+  private:
+    // Max number of tiles. Empty space in the level data is 0x1F.
+    static const int32_t TILES_MAX = 32;
+
+    // Tiles converted to color_t. Last one is filled with background color
+    // and used for empty space.
+    static color_t tile_cache[TILES_MAX + 1][TILE_SIZE * TILE_SIZE];
+
+    // Map data
+    const uint8_t* map = nullptr;
+    // Map size in tiles
+    int32_t map_w = 0;
+    int32_t map_h = 0;
+    // Empty space tile index
+    uint8_t empty_tile = 0U;
+    // Tiles count
+    int32_t tiles_cnt = 0;
+    // Background color
+    color_t bg_color = 0U;
+    // Position of the view in the map
+    int32_t map_pos_x = 0;
+    int32_t map_pos_y = 0;
 };
 
 // *****************************************************************************
-// ***   Gario Sprite Class   **************************************************
+// ***   Enemy Spawn Point   ***************************************************
 // *****************************************************************************
-class GarioSprite : public Image
+struct EnemySpawn
+{
+  // X position of enemy in the tilemap
+  int16_t x;
+  // Y position of enemy in the tilemap
+  int16_t y;
+};
+
+// Enemies of the level, sorted by X position
+static const EnemySpawn level_enemies[] = {{300, 10}, {500, 10}, {600, 10}};
+// Max number of enemies. Enemy pool takes 26 bytes of RAM per enemy, so it is
+// sized by the level instead of the fixed limit.
+static const int32_t ENEMIES_MAX = NumberOf(level_enemies);
+
+// *****************************************************************************
+// ***   Enemy Sprite Class   **************************************************
+// *****************************************************************************
+class EnemySprite : public Sprite<SPRITE_SIZE, SPRITE_SIZE>
 {
   public:
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
-    GarioSprite(int32_t x, int32_t y, TiledMap& tiled_map_t);
+    EnemySprite();
+};
+
+// *****************************************************************************
+// ***   Enemy Pool Class   ****************************************************
+// *****************************************************************************
+// * Enemies stored as arrays of fields instead of array of objects, so
+// * physics loop touches only data it needs. Only enemies in view are
+// * simulated, and only enemies on the screen have a sprite from the pool.
+class EnemyPool
+{
+  public:
+    // *************************************************************************
+    // ***   Init function   ***************************************************
+    // *************************************************************************
+    // * Spawn points should be sorted by X position.
+    void Init(LevelMap& tiled_map_t, EnemySprite* sprites_t, int32_t sprites_cnt_t,
+              const EnemySpawn* spawn, int32_t spawn_cnt);
 
     // *************************************************************************
     // ***   Process function   ************************************************
     // *************************************************************************
-    bool Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_ms);
+    void Process(int32_t tick_ms, int32_t time_ms);
 
     // *************************************************************************
-    // ***   Jump function   ***************************************************
+    // ***   Find contact function   *******************************************
     // *************************************************************************
-    void Jump() {y_speed = -JUMP_SPEED; y_speed_rest = 0; jump = true;}
+    // * Returns index of walking enemy overlapping area or -1 if there is none.
+    // * Enemies without sprite aren't shown, so they can't be touched.
+    int32_t FindContact(int32_t x, int32_t y, int32_t w, int32_t h);
 
     // *************************************************************************
     // ***   Die function   ****************************************************
     // *************************************************************************
-    void Die() {is_die = true; time_to_die = 2000;}
+    void Die(int32_t idx);
 
     // *************************************************************************
-    // ***   Is alive function   ***********************************************
+    // ***   Get Y position function   *****************************************
     // *************************************************************************
-    bool IsAlive() {return !is_die;}
+    int32_t GetY(int32_t idx) {return y_map_pos[idx];}
 
   private:
+    // Enemy states
+    enum State : uint8_t
+    {
+      ENEMY_SLEEP = 0U, // Not in view yet
+      ENEMY_WALK,       // Active
+      ENEMY_DIE,        // Smashed, shown until time_to_die expired
+      ENEMY_GONE        // Out of game
+    };
+
     // Tile map
-    TiledMap& tile_map;
-    // Die flag
-    bool is_die = false;
-    // Time to die
-    int32_t time_to_die = 0;
-    // Variable for switch frames
+    LevelMap* tile_map = nullptr;
+    // Sprites pool
+    EnemySprite* sprites = nullptr;
+    // Sprites count
+    int32_t sprites_cnt = 0;
+    // Enemy index for each sprite or -1 if sprite is free
+    int16_t sprite_owner[ENEMY_SPRITES_MAX] = {0};
+    // Enemy sprite size
+    int32_t width = 0;
+    int32_t height = 0;
+    // Animation frame for all walking enemies
     int32_t move_idx = 0;
-    // X position of sprite in the tilemap
-    int32_t x_map_pos = 0;
-    // Horizontal speed
-    int32_t x_speed = 0;
-    // Rest of speed(hi-res)
-    int32_t x_speed_rest = 0;
-    // Y position of sprite in the tilemap
-    int32_t y_map_pos = 0;
+
+    // Enemies count
+    int32_t enemies_cnt = 0;
+    // Index of next enemy to wake up
+    int32_t next_idx = 0;
+    // X position of enemy in the tilemap. Map fits in int16_t.
+    int16_t x_map_pos[ENEMIES_MAX] = {0};
+    // Y position of enemy in the tilemap
+    int16_t y_map_pos[ENEMIES_MAX] = {0};
+    // Horizontal speed, can't exceed X_SPEED_MAX
+    int16_t x_speed[ENEMIES_MAX] = {0};
+    // Rest of horizontal speed(hi-res), less than 1000
+    int16_t x_speed_rest[ENEMIES_MAX] = {0};
     // Vertical speed
-    int32_t y_speed = 0;
-    // Rest of speed(hi-res)
-    int32_t y_speed_rest = 0;
-    // Jump after enemy
-    bool jump = false;
+    int32_t y_speed[ENEMIES_MAX] = {0};
+    // Rest of vertical speed(hi-res)
+    int32_t y_speed_rest[ENEMIES_MAX] = {0};
+    // Time to die
+    int16_t time_to_die[ENEMIES_MAX] = {0};
+    // Sprite index or -1 if enemy isn't on the screen
+    int8_t sprite[ENEMIES_MAX] = {0};
+    // Enemy state
+    State state[ENEMIES_MAX] = {ENEMY_SLEEP};
+
+    // Indexes of active(walking or dying) enemies
+    uint16_t active[ENEMIES_MAX] = {0};
+    // Active enemies count
+    int32_t active_cnt = 0;
+
+    // Broadphase grid: walking enemies sorted by cells
+    uint16_t cell_start[GRID_W * GRID_H + 1] = {0};
+    uint16_t cell_items[ENEMIES_MAX] = {0};
+    // Cell of each active enemy, used while grid is built
+    uint16_t active_cell[ENEMIES_MAX] = {0};
+
+    // *************************************************************************
+    // ***   Private: Move enemy   *********************************************
+    // *************************************************************************
+    void MoveEnemy(int32_t idx, int32_t tick_ms);
+
+    // *************************************************************************
+    // ***   Private: Update enemy sprite   ************************************
+    // *************************************************************************
+    void UpdateSprite(int32_t idx, bool anim);
+
+    // *************************************************************************
+    // ***   Private: Build broadphase grid   **********************************
+    // *************************************************************************
+    void BuildGrid();
+
+    // *************************************************************************
+    // ***   Private: Enemy to enemy contacts   ********************************
+    // *************************************************************************
+    void ProcessContacts();
+
+    // *************************************************************************
+    // ***   Private: Get grid cell column or row by map position   ************
+    // *************************************************************************
+    int32_t GetCellX(int32_t x);
+    int32_t GetCellY(int32_t y);
 };
 
 // *****************************************************************************
-// ***   Enemy Sprite Class   **************************************************
+// ***   Application Class   ***************************************************
+// *****************************************************************************
+class Gario : public AppTask
+{
+  public:
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static Gario& GetInstance(void);
+
+    // *************************************************************************
+    // ***   Application Loop   ************************************************
+    // *************************************************************************
+    virtual Result Loop();
+
+  private:
+    // Display driver instance
+    DisplayDrv& display_drv = DisplayDrv::GetInstance();
+    // Input log instance, used instead of input driver for record & replay
+    InputLog& input_log = InputLog::GetInstance();
+    // Sound driver instance
+    SoundDrv& sound_drv = SoundDrv::GetInstance();
+
+    // Time variable
+    uint32_t time_ms = 0U;
+
+    // Enemies of the level. Arrays are too big for the task stack.
+    EnemyPool enemy_pool;
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    Gario() : AppTask(APPLICATION_TASK_STACK_SIZE, APPLICATION_TASK_PRIORITY,
+                      "Gario") {};
+};
+
+// *****************************************************************************
+// ***   Gario Sprite Class   **************************************************
 // *****************************************************************************
-class EnemySprite : public Image
+class GarioSprite : public Sprite<SPRITE_SIZE, SPRITE_SIZE>
 {
   public:
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
-    EnemySprite(int32_t x, int32_t y, TiledMap& tiled_map_t);
+    GarioSprite(int32_t x, int32_t y, LevelMap& tiled_map_t);
 
     // *************************************************************************
     // ***   Process function   ************************************************
     // *************************************************************************
-    void Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_ms);
+    bool Process(int32_t dx, int32_t dy, int32_t tick_ms, int32_t time_ms);
+
+    // *************************************************************************
+    // ***   Jump function   ***************************************************
+    // *************************************************************************
+    void Jump() {y_speed = -JUMP_SPEED; y_speed_rest = 0; jump = true;}
 
     // *************************************************************************
     // ***   Die function   ****************************************************
@@ -161,19 +370,17 @@ class EnemySprite : public Image
 
   private:
     // Tile map
-    TiledMap& tile_map;
-    // Variable for switch frames
-    int32_t move_idx = 0;
-    // Active flag
-    bool is_active = false;
+    LevelMap& tile_map;
     // Die flag
     bool is_die = false;
     // Time to die
     int32_t time_to_die = 0;
+    // Variable for switch frames
+    int32_t move_idx = 0;
     // X position of sprite in the tilemap
     int32_t x_map_pos = 0;
     // Horizontal speed
-    int32_t x_speed = -X_SPEED_MIN/2;
+    int32_t x_speed = 0;
     // Rest of speed(hi-res)
     int32_t x_speed_rest = 0;
     // Y position of sprite in the tilemap
@@ -182,6 +389,8 @@ class EnemySprite : public Image
     int32_t y_speed = 0;
     // Rest of speed(hi-res)
     int32_t y_speed_rest = 0;
+    // Jump after enemy
+    bool jump = false;
 };
 
 #endif
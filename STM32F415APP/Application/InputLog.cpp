@@ -0,0 +1,237 @@
+//******************************************************************************
+//  @file InputLog.cpp
+//  @details Application: Input record & replay Class, implementation
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "InputLog.h"
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+InputLog& InputLog::GetInstance(void)
+{
+   static InputLog input_log;
+   return input_log;
+}
+
+// *****************************************************************************
+// ***   Start   ***************************************************************
+// *****************************************************************************
+FRESULT InputLog::Start(Mode mode_t, const char* file_name)
+{
+  // Stop previous session
+  FRESULT fres = Stop();
+  // New session has no errors yet
+  error = FR_OK;
+
+  if(mode_t != MODE_LIVE)
+  {
+    // Mount SD
+    fres = f_mount(&SDFatFS, (TCHAR const*)SDPath, 0);
+    // Open file
+    if(fres == FR_OK)
+    {
+      fres = f_open(&file, file_name, (mode_t == MODE_RECORD) ? (FA_CREATE_ALWAYS | FA_WRITE) : FA_READ);
+    }
+    // Set mode only if file opened
+    if(fres == FR_OK)
+    {
+      mode = mode_t;
+      buf_cnt = 0U;
+      buf_pos = 0U;
+    }
+  }
+
+  return fres;
+}
+
+// *****************************************************************************
+// ***   Stop   ****************************************************************
+// *****************************************************************************
+FRESULT InputLog::Stop(void)
+{
+  FRESULT fres = FR_OK;
+
+  // Write rest of the buffer
+  if(mode == MODE_RECORD)
+  {
+    fres = Flush();
+  }
+  // Close file
+  if(mode != MODE_LIVE)
+  {
+    FRESULT close_res = f_close(&file);
+    if(fres == FR_OK) fres = close_res;
+  }
+  // Back to live input
+  mode = MODE_LIVE;
+  // Error happened before session stop
+  if(fres == FR_OK) fres = error;
+
+  return fres;
+}
+
+// *****************************************************************************
+// ***   GetSeed   *************************************************************
+// *****************************************************************************
+uint32_t InputLog::GetSeed(uint32_t seed)
+{
+  return (uint32_t)Log((int32_t)seed);
+}
+
+// *****************************************************************************
+// ***   GetTime   *************************************************************
+// *****************************************************************************
+uint32_t InputLog::GetTime(uint32_t time_ms)
+{
+  return (uint32_t)Log((int32_t)time_ms);
+}
+
+// *****************************************************************************
+// ***   Frame   ***************************************************************
+// *****************************************************************************
+void InputLog::Frame(uint32_t stamp)
+{
+  // Game doesn't follow recorded session anymore - stop replay
+  if(((uint32_t)Log((int32_t)stamp) != stamp) && (mode == MODE_REPLAY))
+  {
+    (void) Stop();
+  }
+}
+
+// *****************************************************************************
+// ***   GetDeviceType   *******************************************************
+// *****************************************************************************
+InputDrv::ExtDeviceType InputLog::GetDeviceType(InputDrv::PortType port)
+{
+  return (InputDrv::ExtDeviceType)Log(input_drv.GetDeviceType(port));
+}
+
+// *****************************************************************************
+// ***   GetButtonState   ******************************************************
+// *****************************************************************************
+bool InputLog::GetButtonState(InputDrv::PortType port, InputDrv::ButtonType button)
+{
+  return (Log(input_drv.GetButtonState(port, button)) != 0);
+}
+
+// *****************************************************************************
+// ***   GetEncoderState   *****************************************************
+// *****************************************************************************
+int32_t InputLog::GetEncoderState(InputDrv::PortType port, int32_t& last_enc_val)
+{
+  // Encoder read in any mode to keep last value actual after replay ends
+  return Log(input_drv.GetEncoderState(port, last_enc_val));
+}
+
+// *****************************************************************************
+// ***   GetEncoderButtonState   ***********************************************
+// *****************************************************************************
+bool InputLog::GetEncoderButtonState(InputDrv::PortType port, InputDrv::EncButtonType button)
+{
+  return (Log(input_drv.GetEncoderButtonState(port, button)) != 0);
+}
+
+// *****************************************************************************
+// ***   GetEncoderButtonState   ***********************************************
+// *****************************************************************************
+bool InputLog::GetEncoderButtonState(InputDrv::PortType port, InputDrv::EncButtonType button, bool& btn_state)
+{
+  bool changed = input_drv.GetEncoderButtonState(port, button, btn_state);
+  // Both change flag and new button state are logged
+  changed = (Log(changed) != 0);
+  btn_state = (Log(btn_state) != 0);
+  return changed;
+}
+
+// *****************************************************************************
+// ***   GetJoystickState   ****************************************************
+// *****************************************************************************
+void InputLog::GetJoystickState(InputDrv::PortType port, int32_t& x, int32_t& y)
+{
+  input_drv.GetJoystickState(port, x, y);
+  x = Log(x);
+  y = Log(y);
+}
+
+// *****************************************************************************
+// ***   GetJoystickButtonState   **********************************************
+// *****************************************************************************
+bool InputLog::GetJoystickButtonState(InputDrv::PortType port)
+{
+  return (Log(input_drv.GetJoystickButtonState(port)) != 0);
+}
+
+// *****************************************************************************
+// ***   Private: Log   ********************************************************
+// *****************************************************************************
+int32_t InputLog::Log(int32_t val)
+{
+  int32_t result = val;
+
+  if(mode == MODE_RECORD)
+  {
+    // Store value
+    buf[buf_pos++] = val;
+    // Write buffer to the file when it full
+    if(buf_pos >= BUF_SIZE)
+    {
+      FRESULT fres = Flush();
+      // Can't write - stop record and save error for Stop()
+      if(fres != FR_OK)
+      {
+        (void) f_close(&file);
+        mode = MODE_LIVE;
+        error = fres;
+      }
+    }
+  }
+  else if(mode == MODE_REPLAY)
+  {
+    // Read next part of the file when buffer is over
+    if(buf_pos >= buf_cnt)
+    {
+      UINT rbytes = 0U;
+      FRESULT fres = f_read(&file, buf, sizeof(buf), &rbytes);
+      // Can't read - stop replay and save error for Stop()
+      if(fres != FR_OK)
+      {
+        rbytes = 0U;
+        error = fres;
+      }
+      buf_cnt = rbytes / sizeof(buf[0]);
+      buf_pos = 0U;
+    }
+    if(buf_pos < buf_cnt)
+    {
+      result = buf[buf_pos++];
+    }
+    else
+    {
+      // Recorded session is over - continue with live input
+      (void) Stop();
+    }
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Flush   ******************************************************
+// *****************************************************************************
+FRESULT InputLog::Flush(void)
+{
+  UINT wbytes = 0U;
+  UINT size = buf_pos * sizeof(buf[0]);
+  FRESULT fres = f_write(&file, buf, size, &wbytes);
+  // Not all data written - disk full
+  if((fres == FR_OK) && (wbytes != size))
+  {
+    fres = FR_DENIED;
+  }
+  buf_pos = 0U;
+  return fres;
+}
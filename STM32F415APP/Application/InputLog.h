@@ -0,0 +1,126 @@
+//******************************************************************************
+//  @file InputLog.h
+//  @details Application: Input record & replay Class, header
+//
+//  Games read input through this class instead of InputDrv. In record mode
+//  every value returned to the game, RNG seed and logic step timestamps are
+//  written to a file on SD card. In replay mode the same values are read
+//  back from the file, so game runs the same session again.
+//
+//******************************************************************************
+
+#ifndef InputLog_h
+#define InputLog_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "InputDrv.h"
+
+#include "fatfs.h"
+
+// *****************************************************************************
+// ***   Input Log Class   *****************************************************
+// *****************************************************************************
+class InputLog
+{
+  public:
+    // Log modes
+    enum Mode
+    {
+      MODE_LIVE = 0, // Input from InputDrv
+      MODE_RECORD,   // Input from InputDrv, values written to file
+      MODE_REPLAY    // Input from file
+    };
+
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static InputLog& GetInstance(void);
+
+    // *************************************************************************
+    // ***   Start record or replay   ******************************************
+    // *************************************************************************
+    FRESULT Start(Mode mode_t, const char* file_name);
+
+    // *************************************************************************
+    // ***   Stop record or replay   *******************************************
+    // *************************************************************************
+    // * Returns first file error of the session, including write errors that
+    // * stopped record before Stop() call.
+    FRESULT Stop(void);
+
+    // *************************************************************************
+    // ***   Check replay mode   ***********************************************
+    // *************************************************************************
+    bool IsReplay(void) const {return (mode == MODE_REPLAY);}
+
+    // *************************************************************************
+    // ***   Get seed for random generator   ***********************************
+    // *************************************************************************
+    uint32_t GetSeed(uint32_t seed);
+
+    // *************************************************************************
+    // ***   Get time of input read   ******************************************
+    // *************************************************************************
+    // * Returns time_ms, in replay mode returns recorded time instead.
+    uint32_t GetTime(uint32_t time_ms);
+
+    // *************************************************************************
+    // ***   Logic step stamp   ************************************************
+    // *************************************************************************
+    // * Stamp is time or number of logic step. Replay switches to live input if
+    // * stamp doesn't match recorded one.
+    void Frame(uint32_t stamp);
+
+    // *************************************************************************
+    // ***   InputDrv functions   **********************************************
+    // *************************************************************************
+    InputDrv::ExtDeviceType GetDeviceType(InputDrv::PortType port);
+    bool GetButtonState(InputDrv::PortType port, InputDrv::ButtonType button);
+    int32_t GetEncoderState(InputDrv::PortType port, int32_t& last_enc_val);
+    bool GetEncoderButtonState(InputDrv::PortType port, InputDrv::EncButtonType button);
+    bool GetEncoderButtonState(InputDrv::PortType port, InputDrv::EncButtonType button, bool& btn_state);
+    void GetJoystickState(InputDrv::PortType port, int32_t& x, int32_t& y);
+    bool GetJoystickButtonState(InputDrv::PortType port);
+
+  private:
+    // Values in the buffer
+    static const uint32_t BUF_SIZE = 128U;
+
+    // Input driver instance
+    InputDrv& input_drv = InputDrv::GetInstance();
+
+    // Current mode
+    Mode mode = MODE_LIVE;
+    // First file error of the session
+    FRESULT error = FR_OK;
+    // File object
+    FIL file;
+    // Values buffer
+    int32_t buf[BUF_SIZE] = {0};
+    // Values in buffer for replay
+    uint32_t buf_cnt = 0U;
+    // Current position in buffer
+    uint32_t buf_pos = 0U;
+
+    // *************************************************************************
+    // ***   Private: Log value   **********************************************
+    // *************************************************************************
+    // * In record mode writes value to the file and returns it, in replay mode
+    // * returns value from the file instead.
+    int32_t Log(int32_t val);
+
+    // *************************************************************************
+    // ***   Private: Flush buffer to the file   *******************************
+    // *************************************************************************
+    FRESULT Flush(void);
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    InputLog() {};
+};
+
+#endif
@@ -45,8 +45,8 @@ Pong& Pong::GetInstance(void)
 // *****************************************************************************
 Result Pong::Loop()
 {
-  if(   (input_drv.GetDeviceType(InputDrv::EXT_LEFT) == InputDrv::EXT_DEV_BTN)
-     || (input_drv.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_BTN) )
+  if(   (input_log.GetDeviceType(InputDrv::EXT_LEFT) == InputDrv::EXT_DEV_BTN)
+     || (input_log.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_BTN) )
   {
     UiMsgBox msg_box("Buttons module can't be used", "Error!");
     msg_box.Run(3000U);
@@ -56,11 +56,11 @@ Result Pong::Loop()
     uint8_t left_score = 0U;
     uint8_t right_score = 0U;
     // Init last encoders & buttons values
-    (void) input_drv.GetEncoderState(InputDrv::EXT_LEFT,  last_enc_left_val);
-    (void) input_drv.GetEncoderState(InputDrv::EXT_RIGHT, last_enc_right_val);
+    (void) input_log.GetEncoderState(InputDrv::EXT_LEFT,  last_enc_left_val);
+    (void) input_log.GetEncoderState(InputDrv::EXT_RIGHT, last_enc_right_val);
 
     // Initialize random seed
-    srand(RtosTick::GetTickCount());
+    srand(input_log.GetSeed(RtosTick::GetTickCount()));
 
     char scr_str[32] = {" 0 : 0 "};
     String score_str(scr_str, (display_drv.GetScreenW() - strlen(scr_str) * Font_12x16::GetInstance().GetCharW())/2,
@@ -85,21 +85,48 @@ Result Pong::Loop()
 
     // Clear Game Over flag before start game
     game_over = false;
+    // Each game starts the same way, so recorded input can be replayed
+    x_dir = 1;
+    y_dir = 1;
+    speed = 5;
+
+    // Fixed timestep loop
+    GameLoop game_loop(TICK_MS);
+    game_loop.Start();
+    // Logic time, increased by TICK_MS each logic step
+    uint32_t time_ms = 0U;
+    // Encoders velocity is measured from the game start
+    uint32_t enc_time_ms = input_log.GetTime(RtosTick::GetTickCount());
+    enc_left_accel.Reset(enc_time_ms);
+    enc_right_accel.Reset(enc_time_ms);
 
     // Game cycle
     while(game_over == false)
     {
+      // Replay recorded input as fast as possible
+      game_loop.SetFreeRun(input_log.IsReplay());
+      // Logic steps due at this frame
+      while((game_over == false) && game_loop.Update())
+      {
         // Lock Display
         display_drv.LockDisplay();
 
-        if(input_drv.GetDeviceType(InputDrv::EXT_LEFT) == InputDrv::EXT_DEV_ENC)
+        // Logic step stamp for input log
+        input_log.Frame(time_ms);
+        // Real time of encoders read for encoders velocity. Catch-up steps
+        // run back to back, so logic time can't be used here.
+        enc_time_ms = input_log.GetTime(RtosTick::GetTickCount());
+
+        if(input_log.GetDeviceType(InputDrv::EXT_LEFT) == InputDrv::EXT_DEV_ENC)
         {
           // Get encoder 1 count since last call
-          enc_left_cnt = input_drv.GetEncoderState(InputDrv::EXT_LEFT, last_enc_left_val);
+          enc_left_cnt = input_log.GetEncoderState(InputDrv::EXT_LEFT, last_enc_left_val);
+          // Box movement depends on encoder speed
+          int32_t move = enc_left_accel.Process(enc_left_cnt, enc_time_ms);
           // Process result
-          if(enc_left_cnt != 0)
+          if(move != 0)
           {
-            box_left.Move(0, enc_left_cnt*abs(enc_left_cnt)*3, true);
+            box_left.Move(0, move, true);
             if(box_left.GetStartY() < 0)
             {
               box_left.Move(box_left.GetStartX(), 0);
@@ -111,14 +138,16 @@ Result Pong::Loop()
           }
         }
 
-        if(input_drv.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_ENC)
+        if(input_log.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_ENC)
         {
           // Get encoder 2 count since last call
-          enc_right_cnt = input_drv.GetEncoderState(InputDrv::EXT_RIGHT, last_enc_right_val);
+          enc_right_cnt = input_log.GetEncoderState(InputDrv::EXT_RIGHT, last_enc_right_val);
+          // Box movement depends on encoder speed
+          int32_t move = enc_right_accel.Process(enc_right_cnt, enc_time_ms);
           // Process result
-          if(enc_right_cnt != 0)
+          if(move != 0)
           {
-            box_right.Move(0, -enc_right_cnt*abs(enc_right_cnt)*3, true);
+            box_right.Move(0, -move, true);
             if(box_right.GetStartY() < 0)
             {
               box_right.Move(box_right.GetStartX(), 0);
@@ -130,24 +159,24 @@ Result Pong::Loop()
           }
         }
 
-        if(input_drv.GetDeviceType(InputDrv::EXT_LEFT) == InputDrv::EXT_DEV_JOY)
+        if(input_log.GetDeviceType(InputDrv::EXT_LEFT) == InputDrv::EXT_DEV_JOY)
         {
           int32_t x = 0;
           int32_t y = 0;
           // Get encoder 1 count since last call
-          input_drv.GetJoystickState(InputDrv::EXT_LEFT, x, y);
+          input_log.GetJoystickState(InputDrv::EXT_LEFT, x, y);
           // Calculate position
           int32_t pos = ((display_drv.GetScreenH() - BOX_H) * y) / 0xFFF;
           // Move box
           box_left.Move(box_left.GetStartX(), pos);
         }
 
-        if(input_drv.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_JOY)
+        if(input_log.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_JOY)
         {
           int32_t x = 0;
           int32_t y = 0;
           // Get encoder 1 count since last call
-          input_drv.GetJoystickState(InputDrv::EXT_RIGHT, x, y);
+          input_log.GetJoystickState(InputDrv::EXT_RIGHT, x, y);
           // Calculate position
           int32_t pos = ((display_drv.GetScreenH() - BOX_H) * y) / 0xFFF;
           // Move box
@@ -160,13 +189,13 @@ Result Pong::Loop()
           InputDrv::PortType port = (x_dir > 0) ? InputDrv::EXT_LEFT : InputDrv::EXT_RIGHT;
 
           // If any encoder button pressed
-          if(   (input_drv.GetDeviceType(port) == InputDrv::EXT_DEV_ENC)
-             && (input_drv.GetEncoderButtonState(port, InputDrv::ENC_BTN_ENT) == true) )
+          if(   (input_log.GetDeviceType(port) == InputDrv::EXT_DEV_ENC)
+             && (input_log.GetEncoderButtonState(port, InputDrv::ENC_BTN_ENT) == true) )
           {
             speed = 5;
           }
-          if(   (input_drv.GetDeviceType(port) == InputDrv::EXT_DEV_JOY)
-             && (input_drv.GetJoystickButtonState(port) == true) )
+          if(   (input_log.GetDeviceType(port) == InputDrv::EXT_DEV_JOY)
+             && (input_log.GetJoystickButtonState(port) == true) )
           {
             speed = 5;
           }
@@ -198,10 +227,14 @@ Result Pong::Loop()
         score_str.InvalidateObjArea();
         // Unlock Display
         display_drv.UnlockDisplay();
-        // Update Display
-        display_drv.UpdateDisplay();
-        // Pause until next tick
-        RtosTick::DelayUntilMs(last_wake_ticks, TICK_MS);
+
+        // Next logic step
+        time_ms += TICK_MS;
+      }
+      // Update Display
+      game_loop.Render();
+      // Pause until next tick
+      game_loop.Wait();
     }
     box_left.Hide();
     box_right.Hide();
@@ -27,6 +27,9 @@
 #include "InputDrv.h"
 #include "SoundDrv.h"
 #include "UiEngine.h"
+#include "GameLoop.h"
+#include "EncoderAccel.h"
+#include "InputLog.h"
 
 // *****************************************************************************
 // ***   Local const variables   ***********************************************
@@ -72,6 +75,10 @@ class Pong : public AppTask
     int32_t enc_left_cnt = 0;
     // Encoder 2 count
     int32_t enc_right_cnt = 0;
+    // Encoders acceleration: 3 pixels per count at 20 counts per second
+    // (one count per 50 ms) and 3 pixels more for each next 20 counts per second
+    EncoderAccel enc_left_accel = EncoderAccel(1, 150, 24);
+    EncoderAccel enc_right_accel = EncoderAccel(1, 150, 24);
     // Button states
     bool btn_states[InputDrv::BTN_MAX] = { false };
     // Encoder variable
@@ -81,8 +88,8 @@ class Pong : public AppTask
   
     // Display driver instance
     DisplayDrv& display_drv = DisplayDrv::GetInstance();
-    // Input driver instance
-    InputDrv& input_drv = InputDrv::GetInstance();
+    // Input log instance, used instead of input driver for record & replay
+    InputLog& input_log = InputLog::GetInstance();
     // Sound driver instance
     SoundDrv& sound_drv = SoundDrv::GetInstance();
     
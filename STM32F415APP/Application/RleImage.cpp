@@ -0,0 +1,105 @@
+//******************************************************************************
+//  @file RleImage.cpp
+//  @details Application: RLE Image Class, implementation
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "RleImage.h"
+
+// *****************************************************************************
+// ***   RleDecode   ***********************************************************
+// *****************************************************************************
+void RleDecode(const RleImageDesc& img, color_t* buf, color_t transparent_color)
+{
+  for(int32_t y = 0; y < img.height; y++)
+  {
+    const uint8_t* run = &img.data[img.rows[y]];
+    color_t* dst = &buf[y * img.width];
+    for(int32_t x = 0; x < img.width;)
+    {
+      uint8_t type = *run & RLE_TYPE_MASK;
+      int32_t len = (*run++ & RLE_LEN_MASK) + 1;
+      for(int32_t i = 0; i < len; i++)
+      {
+        if(type == RLE_SKIP)      dst[x + i] = transparent_color;
+        else if(type == RLE_FILL) dst[x + i] = img.palette[*run];
+        else                      dst[x + i] = img.palette[*run++];
+      }
+      if(type == RLE_FILL) run++;
+      x += len;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+RleImage::RleImage(int32_t x, int32_t y, const RleImageDesc& img_t) : img(&img_t)
+{
+  x_start = x;
+  y_start = y;
+  x_end = x + img_t.width - 1;
+  y_end = y + img_t.height - 1;
+  width = img_t.width;
+  height = img_t.height;
+}
+
+// *****************************************************************************
+// ***   SetImage   ************************************************************
+// *****************************************************************************
+void RleImage::SetImage(const RleImageDesc& img_t)
+{
+  if(img != &img_t)
+  {
+    img = &img_t;
+    InvalidateObjArea();
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RleImage::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end) && (x_start < start_x + n) && (x_end >= start_x))
+  {
+    const uint8_t* run = &img->data[img->rows[line - y_start]];
+    // Image position in the buffer
+    int32_t x = x_start - start_x;
+    // Runs are clipped only if image row isn't entirely in the buffer
+    if((x >= 0) && (x + width <= n)) DrawRow<false>(&buf[x], width, run, 0);
+    else                             DrawRow<true>(buf, n, run, x);
+  }
+}
+
+// *****************************************************************************
+// ***   Draw row of the image   ***********************************************
+// *****************************************************************************
+template<bool CLIP> void RleImage::DrawRow(color_t* buf, int32_t n, const uint8_t* run, int32_t x)
+{
+  const color_t* palette = img->palette;
+  // Stop when image row or buffer ends
+  int32_t row_end = CLIP ? ((x + width < n) ? x + width : n) : width;
+  while(x < row_end)
+  {
+    uint8_t type = *run & RLE_TYPE_MASK;
+    int32_t len = (*run++ & RLE_LEN_MASK) + 1;
+    // Part of the run in the buffer
+    int32_t start = (CLIP && (x < 0)) ? 0 : x;
+    int32_t end = (CLIP && (x + len > row_end)) ? row_end : x + len;
+    if(type == RLE_FILL)
+    {
+      color_t color = palette[*run++];
+      for(int32_t p = start; p < end; p++) buf[p] = color;
+    }
+    else if(type == RLE_COPY)
+    {
+      for(int32_t p = start; p < end; p++) buf[p] = palette[run[p - x]];
+      run += len;
+    }
+    x += len;
+  }
+}
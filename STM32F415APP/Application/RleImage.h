@@ -0,0 +1,209 @@
+//******************************************************************************
+//  @file RleImage.h
+//  @details Application: RLE Image Class, header
+//
+//  8-bit palette image stored as runs. Each row is a sequence of runs, run
+//  starts with control byte:
+//    bits 7-6 - run type: skip(transparent pixels), fill(one palette index
+//               follows) or copy("length" palette indexes follow)
+//    bits 5-0 - run length - 1
+//
+//  Images are encoded at compile time from the raw 8-bit arrays, so raw
+//  arrays are used only by the compiler and don't take flash:
+//
+//    static constexpr uint8_t img_data[] = {...};
+//    static constexpr auto img_rle = RLE_ENCODE(W, img_data, TRANSPARENT_IDX);
+//    const RleImageDesc img = {W, H, img_rle.rows, img_rle.data, PALETTE_884};
+//
+//******************************************************************************
+
+#ifndef RleImage_h
+#define RleImage_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "DisplayDrv.h"
+
+// *****************************************************************************
+// ***   RLE format   **********************************************************
+// *****************************************************************************
+// Run types
+static const uint8_t RLE_SKIP = 0x00U;
+static const uint8_t RLE_FILL = 0x40U;
+static const uint8_t RLE_COPY = 0x80U;
+// Run type and length masks
+static const uint8_t RLE_TYPE_MASK = 0xC0U;
+static const uint8_t RLE_LEN_MASK = 0x3FU;
+// Max run length
+static const uint32_t RLE_LEN_MAX = 64U;
+
+// RLE image description
+struct RleImageDesc
+{
+  // Image size
+  int32_t width;
+  int32_t height;
+  // Offset of each row in data
+  const uint16_t* rows;
+  // Runs
+  const uint8_t* data;
+  // Palette
+  const color_t* palette;
+};
+
+// *****************************************************************************
+// ***   RLE Decode   **********************************************************
+// *****************************************************************************
+// * Decode image to buf. Transparent pixels are set to transparent_color.
+void RleDecode(const RleImageDesc& img, color_t* buf, color_t transparent_color);
+
+// *****************************************************************************
+// ***   RLE Encoder   *********************************************************
+// *****************************************************************************
+// Encoded image
+template<uint32_t H, uint32_t N> struct RleData
+{
+  uint16_t rows[H];
+  uint8_t data[N];
+};
+
+// Run found by encoder
+struct RleRun
+{
+  uint8_t type;
+  uint32_t len;
+};
+
+// *****************************************************************************
+// ***   RleNextRun   **********************************************************
+// *****************************************************************************
+// * Find run at position pos. Three or more same pixels are filled, other
+// * pixels are copied.
+template<uint32_t N> constexpr RleRun RleNextRun(const uint8_t (&img)[N], uint32_t pos,
+                                                 uint32_t row_end, uint8_t transparent)
+{
+  // Same pixels count
+  uint32_t same = 1U;
+  while((pos + same < row_end) && (same < RLE_LEN_MAX) && (img[pos + same] == img[pos])) same++;
+  RleRun run = {RLE_SKIP, same};
+  if(img[pos] != transparent)
+  {
+    if(same >= 3U)
+    {
+      run.type = RLE_FILL;
+    }
+    else
+    {
+      // Copy pixels up to transparent pixel or three same pixels
+      run.type = RLE_COPY;
+      run.len = 0U;
+      while((pos + run.len < row_end) && (run.len < RLE_LEN_MAX) && (img[pos + run.len] != transparent)
+            && !((pos + run.len + 2U < row_end) && (img[pos + run.len] == img[pos + run.len + 1U])
+                                                && (img[pos + run.len] == img[pos + run.len + 2U])))
+      {
+        run.len++;
+      }
+    }
+  }
+  return run;
+}
+
+// *****************************************************************************
+// ***   RleSize   *************************************************************
+// *****************************************************************************
+// * Size of encoded data of W pixels wide image
+template<uint32_t W, uint32_t N> constexpr uint32_t RleSize(const uint8_t (&img)[N], uint8_t transparent)
+{
+  uint32_t size = 0U;
+  for(uint32_t row = 0U; row < N; row += W)
+  {
+    for(uint32_t pos = row; pos < row + W;)
+    {
+      RleRun run = RleNextRun(img, pos, row + W, transparent);
+      size += 1U + ((run.type == RLE_FILL) ? 1U : 0U) + ((run.type == RLE_COPY) ? run.len : 0U);
+      pos += run.len;
+    }
+  }
+  return size;
+}
+
+// *****************************************************************************
+// ***   RleEncode   ***********************************************************
+// *****************************************************************************
+// * Encode W pixels wide image, S is size returned by RleSize()
+template<uint32_t W, uint32_t S, uint32_t N> constexpr RleData<N / W, S> RleEncode(const uint8_t (&img)[N],
+                                                                                  uint8_t transparent)
+{
+  static_assert(N % W == 0U, "Wrong image size");
+  static_assert(S <= 0x10000U, "Row offsets are 16-bit");
+  RleData<N / W, S> rle = {};
+  uint32_t size = 0U;
+  for(uint32_t row = 0U; row < N; row += W)
+  {
+    rle.rows[row / W] = size;
+    for(uint32_t pos = row; pos < row + W;)
+    {
+      RleRun run = RleNextRun(img, pos, row + W, transparent);
+      rle.data[size++] = run.type | (run.len - 1U);
+      if(run.type == RLE_FILL)
+      {
+        rle.data[size++] = img[pos];
+      }
+      else if(run.type == RLE_COPY)
+      {
+        for(uint32_t i = 0U; i < run.len; i++) rle.data[size++] = img[pos + i];
+      }
+      pos += run.len;
+    }
+  }
+  return rle;
+}
+
+// Encode W pixels wide image at compile time
+#define RLE_ENCODE(w, img, transparent) RleEncode<(w), RleSize<(w)>((img), (transparent))>((img), (transparent))
+
+// *****************************************************************************
+// ***   RLE Image Class   *****************************************************
+// *****************************************************************************
+// * Image drawn directly from runs: transparent runs are skipped, fill run
+// * takes one palette lookup. Horizontal flip isn't supported.
+class RleImage : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    RleImage(int32_t x, int32_t y, const RleImageDesc& img_t);
+
+    // *************************************************************************
+    // ***   Set image   *******************************************************
+    // *************************************************************************
+    // * Image should have the same size. Only image pointer is changed, so it
+    // * can be called with display semaphore taken or not.
+    void SetImage(const RleImageDesc& img_t);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y) {};
+
+  private:
+    // Current image
+    const RleImageDesc* img;
+
+    // *************************************************************************
+    // ***   Draw row of the image   *******************************************
+    // *************************************************************************
+    // * x - image position in the buffer, runs are clipped to the buffer only
+    // * if CLIP is true.
+    template<bool CLIP> void DrawRow(color_t* buf, int32_t n, const uint8_t* run, int32_t x);
+};
+
+#endif
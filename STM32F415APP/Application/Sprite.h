@@ -0,0 +1,195 @@
+//******************************************************************************
+//  @file Sprite.h
+//  @details Application: Sprite with prepared frames Class, header
+//
+//  Frames are converted from RLE images to color_t once, and opaque pixels
+//  of each row are stored as runs. Line is drawn by kernel
+//  selected once per line by flip flag: it copies opaque runs and skips
+//  transparent ones without palette lookup and transparency check per pixel.
+//
+//  Usage:
+//
+//    SpriteFrame<16, 16> frames[N];
+//    frames[0].Init(img_0_rle_desc);
+//    Sprite<16, 16> sprite(x, y, frames[0]);
+//    sprite.Show(z);
+//
+//******************************************************************************
+
+#ifndef Sprite_h
+#define Sprite_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "RleImage.h"
+
+// *****************************************************************************
+// ***   Sprite Frame   ********************************************************
+// *****************************************************************************
+template<int32_t W, int32_t H> struct SpriteFrame
+{
+  // Run positions are stored in bytes
+  static_assert((W <= 255) && (H <= 255), "Sprite frame is too big");
+
+  // Opaque pixels run in the row
+  struct Run
+  {
+    uint8_t start;
+    uint8_t len;
+  };
+  // Max runs in the row: opaque and transparent pixels alternate
+  static const int32_t RUNS_MAX = (W + 1) / 2;
+
+  // Pixels converted to color_t
+  color_t pix[W * H];
+  // Opaque runs of each row
+  Run runs[H][RUNS_MAX];
+  // Runs count of each row
+  uint8_t runs_cnt[H];
+
+  // ***************************************************************************
+  // ***   Init function   *****************************************************
+  // ***************************************************************************
+  // * img - W x H RLE image, pixels of skip runs aren't drawn.
+  void Init(const RleImageDesc& img)
+  {
+    for(int32_t y = 0; y < H; y++)
+    {
+      const uint8_t* rle = &img.data[img.rows[y]];
+      runs_cnt[y] = 0U;
+      for(int32_t x = 0; x < W;)
+      {
+        uint8_t type = *rle & RLE_TYPE_MASK;
+        int32_t len = (*rle++ & RLE_LEN_MASK) + 1;
+        if(type != RLE_SKIP)
+        {
+          for(int32_t i = 0; i < len; i++)
+          {
+            pix[y * W + x + i] = img.palette[*rle];
+            if(type == RLE_COPY) rle++;
+          }
+          if(type == RLE_FILL) rle++;
+          uint8_t& cnt = runs_cnt[y];
+          // Fill and copy runs next to each other are one opaque run
+          if((cnt > 0U) && (runs[y][cnt - 1U].start + runs[y][cnt - 1U].len == x))
+          {
+            runs[y][cnt - 1U].len += len;
+          }
+          else
+          {
+            runs[y][cnt].start = x;
+            runs[y][cnt].len = len;
+            cnt++;
+          }
+        }
+        x += len;
+      }
+    }
+  }
+};
+
+// *****************************************************************************
+// ***   Sprite Class   ********************************************************
+// *****************************************************************************
+template<int32_t W, int32_t H> class Sprite : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Sprite(int32_t x, int32_t y, const SpriteFrame<W, H>& frame_t) : frame(&frame_t)
+    {
+      x_start = x;
+      y_start = y;
+      x_end = x + W - 1;
+      y_end = y + H - 1;
+      width = W;
+      height = H;
+    }
+
+    // *************************************************************************
+    // ***   Set frame   *******************************************************
+    // *************************************************************************
+    void SetImage(const SpriteFrame<W, H>& frame_t)
+    {
+      if(frame != &frame_t)
+      {
+        frame = &frame_t;
+        InvalidateObjArea();
+      }
+    }
+
+    // *************************************************************************
+    // ***   Set horizontal flip   *********************************************
+    // *************************************************************************
+    void SetHorizontalFlip(bool flip_t)
+    {
+      if(flip != flip_t)
+      {
+        flip = flip_t;
+        InvalidateObjArea();
+      }
+    }
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
+    {
+      // Draw only if needed
+      if((line >= y_start) && (line <= y_end) && (x_start < start_x + n) && (x_end >= start_x))
+      {
+        if(flip) DrawRow<true>(buf, n, line - y_start, x_start - start_x);
+        else     DrawRow<false>(buf, n, line - y_start, x_start - start_x);
+      }
+    }
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y) {};
+
+  private:
+    // Current frame
+    const SpriteFrame<W, H>* frame;
+    // Horizontal flip flag
+    bool flip = false;
+
+    // *************************************************************************
+    // ***   Draw row of the frame   *******************************************
+    // *************************************************************************
+    // * x - sprite position in the buffer, may be out of the buffer.
+    template<bool FLIP> void DrawRow(color_t* buf, int32_t n, int32_t row, int32_t x) const
+    {
+      const color_t* pix = &frame->pix[row * W];
+      const typename SpriteFrame<W, H>::Run* runs = frame->runs[row];
+      for(int32_t r = 0; r < frame->runs_cnt[row]; r++)
+      {
+        // Run position in the buffer
+        int32_t start = FLIP ? x + W - runs[r].start - runs[r].len : x + runs[r].start;
+        int32_t end = start + runs[r].len;
+        // Part of the run in the buffer
+        if(start < 0) start = 0;
+        if(end > n) end = n;
+        if(start < end)
+        {
+          if(FLIP)
+          {
+            // Image column for buffer position p is W - 1 - (p - x)
+            const color_t* src = &pix[x + W - 1 - start];
+            for(int32_t p = start; p < end; p++) buf[p] = *src--;
+          }
+          else
+          {
+            // Runs are short, so copy loop is faster than memcpy() call
+            const color_t* src = &pix[start - x];
+            for(int32_t p = start; p < end; p++) buf[p] = *src++;
+          }
+        }
+      }
+    }
+};
+
+#endif
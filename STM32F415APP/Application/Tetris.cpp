@@ -77,6 +77,18 @@ const bool TetrisShape::shapesArray[7][4*4] =
   {0,1,0,0, 0,1,1,0, 0,0,1,0, 0,0,0,0}, // Z
 };
 
+// Row masks for all shapes in all rotations. Bit N - column N of shape.
+const uint8_t TetrisShape::shapeMasksArray[7][4][4] =
+{
+  {{0x2,0x6,0x2,0x0}, {0x0,0xE,0x4,0x0}, {0x0,0x4,0x6,0x4}, {0x0,0x2,0x7,0x0}}, // T
+  {{0x2,0x2,0x6,0x0}, {0x0,0xE,0x2,0x0}, {0x0,0x6,0x4,0x4}, {0x0,0x4,0x7,0x0}}, // L
+  {{0x4,0x4,0x6,0x0}, {0x0,0x2,0xE,0x0}, {0x0,0x6,0x2,0x2}, {0x0,0x7,0x4,0x0}}, // J
+  {{0x2,0x2,0x2,0x2}, {0x0,0xF,0x0,0x0}, {0x4,0x4,0x4,0x4}, {0x0,0x0,0xF,0x0}}, // I
+  {{0x0,0x6,0x6,0x0}, {0x0,0x6,0x6,0x0}, {0x0,0x6,0x6,0x0}, {0x0,0x6,0x6,0x0}}, // O
+  {{0x4,0x6,0x2,0x0}, {0x0,0x6,0xC,0x0}, {0x0,0x4,0x6,0x2}, {0x0,0x3,0x6,0x0}}, // S
+  {{0x2,0x6,0x4,0x0}, {0x0,0xC,0x6,0x0}, {0x0,0x2,0x6,0x4}, {0x0,0x6,0x3,0x0}}, // Z
+};
+
 // Shape rotating matrix 
 const int8_t TetrisShape::shapeRtArray[4][4*4] = 
 {
@@ -100,20 +112,20 @@ Tetris& Tetris::GetInstance(void)
 // *****************************************************************************
 Result Tetris::Loop()
 {
-  // Bucket object
-  TetrisBucket bucket;
+  // Clear bucket and score from previous game
+  bucket.InitBucket();
   // Shape object
   TetrisShape shape;
   // Next shape object
   TetrisShape next_shape;
 
   // Init last encoders & buttons values
-  (void) input_drv.GetEncoderState(InputDrv::EXT_LEFT,  last_enc1_val);
-  (void) input_drv.GetEncoderState(InputDrv::EXT_RIGHT, last_enc2_val);
-  (void) input_drv.GetEncoderButtonState(InputDrv::EXT_LEFT, InputDrv::ENC_BTN_ENT,  enc1_btn_val);
-  (void) input_drv.GetEncoderButtonState(InputDrv::EXT_LEFT, InputDrv::ENC_BTN_BACK,  enc1_btn_back_val);
-  (void) input_drv.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_ENT, enc2_btn_val);
-  (void) input_drv.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_BACK, enc2_btn_back_val);
+  (void) input_log.GetEncoderState(InputDrv::EXT_LEFT,  last_enc1_val);
+  (void) input_log.GetEncoderState(InputDrv::EXT_RIGHT, last_enc2_val);
+  (void) input_log.GetEncoderButtonState(InputDrv::EXT_LEFT, InputDrv::ENC_BTN_ENT,  enc1_btn_val);
+  (void) input_log.GetEncoderButtonState(InputDrv::EXT_LEFT, InputDrv::ENC_BTN_BACK,  enc1_btn_back_val);
+  (void) input_log.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_ENT, enc2_btn_val);
+  (void) input_log.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_BACK, enc2_btn_back_val);
 
   // String to show pause
   String pause_str("PAUSE", (display_drv.GetScreenW() - strlen("PAUSE")*12)/2,(display_drv.GetScreenH() - 16) / 2, COLOR_WHITE, Font_12x16::GetInstance());
@@ -122,7 +134,7 @@ Result Tetris::Loop()
   sound_drv.PlaySound(music_data_table, NumberOf(music_data_table), 120U, true);
 
   // Initialize random seed
-  srand(RtosTick::GetTickCount());
+  srand(input_log.GetSeed(RtosTick::GetTickCount()));
 
   // Show bucket, shape, next shape and score string on screen
   bucket.Show(1);
@@ -130,7 +142,10 @@ Result Tetris::Loop()
   next_shape.Show(3);
   char scr_str[32] = {" "};
   String score_str(scr_str, (WIDTH + 1u) * CUBE_SIZE, 16, COLOR_WHITE, Font_8x12::GetInstance());
+  score_str.SetString(scr_str, NumberOf(scr_str), "Score: %lu", bucket.GetScore());
   score_str.Show(3);
+  // Score shown on the screen
+  uint32_t shown_score = bucket.GetScore();
 
   // Init ticks variable
   uint32_t last_wake_ticks = RtosTick::GetTickCount();
@@ -141,6 +156,8 @@ Result Tetris::Loop()
   int32_t loops;
   // Pause flag
   bool pause = false;
+  // Frames counter for input log
+  uint32_t frame_cnt = 0U;
 
   while (game_over == false)
   {
@@ -176,10 +193,13 @@ Result Tetris::Loop()
       // Lock Display
       display_drv.LockDisplay();
 
+      // Frame stamp for input log
+      input_log.Frame(frame_cnt++);
+
       // Get encoder 1 count since last call
-      int32_t en_1_cnt = input_drv.GetEncoderState(InputDrv::EXT_LEFT, last_enc1_val);
+      int32_t en_1_cnt = input_log.GetEncoderState(InputDrv::EXT_LEFT, last_enc1_val);
       // Get encoder 2 count since last call
-      int32_t en_2_cnt = input_drv.GetEncoderState(InputDrv::EXT_RIGHT, last_enc2_val);
+      int32_t en_2_cnt = input_log.GetEncoderState(InputDrv::EXT_RIGHT, last_enc2_val);
 
       if((en_1_cnt != 0) && (pause == false))
       {
@@ -220,8 +240,8 @@ Result Tetris::Loop()
       }
 
       // If any encoder button pressed - pull shape down 
-      if(   (input_drv.GetEncoderButtonState(InputDrv::EXT_LEFT,  InputDrv::ENC_BTN_ENT, enc1_btn_val) && enc1_btn_val)
-         || (input_drv.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_ENT, enc2_btn_val) && enc2_btn_val) )
+      if(   (input_log.GetEncoderButtonState(InputDrv::EXT_LEFT,  InputDrv::ENC_BTN_ENT, enc1_btn_val) && enc1_btn_val)
+         || (input_log.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_ENT, enc2_btn_val) && enc2_btn_val) )
       {
         if(pause == false)
         {
@@ -231,8 +251,8 @@ Result Tetris::Loop()
       }
 
       // If any encoder button pressed - pull shape down
-      if(   (input_drv.GetEncoderButtonState(InputDrv::EXT_LEFT,  InputDrv::ENC_BTN_BACK, enc1_btn_back_val) && enc1_btn_back_val)
-         || (input_drv.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_BACK, enc2_btn_back_val) && enc2_btn_back_val) )
+      if(   (input_log.GetEncoderButtonState(InputDrv::EXT_LEFT,  InputDrv::ENC_BTN_BACK, enc1_btn_back_val) && enc1_btn_back_val)
+         || (input_log.GetEncoderButtonState(InputDrv::EXT_RIGHT, InputDrv::ENC_BTN_BACK, enc2_btn_back_val) && enc2_btn_back_val) )
       {
         // Invert pause flag
         pause = !pause;
@@ -267,18 +287,37 @@ Result Tetris::Loop()
           loops--;
         }
       }
-      // Create score string
-      score_str.SetString(scr_str, NumberOf(scr_str), "Score: %lu", bucket.GetScore());
+      // Update score string only if score changed. SetString() invalidates
+      // string area, so static score shouldn't be redrawn every frame.
+      if(bucket.GetScore() != shown_score)
+      {
+        shown_score = bucket.GetScore();
+        score_str.SetString(scr_str, NumberOf(scr_str), "Score: %lu", shown_score);
+      }
       // Unlock Display
       display_drv.UnlockDisplay();
       // Update Display
       display_drv.UpdateDisplay();
-      // Pause until next tick
-      RtosTick::DelayUntilMs(last_wake_ticks, delay);
+      // Replay recorded input as fast as possible
+      if(input_log.IsReplay())
+      {
+        // Give time to the display task only
+        RtosTick::DelayTicks(1U);
+        // Real time frames start from the current time when replay is over
+        last_wake_ticks = RtosTick::GetTickCount();
+      }
+      else
+      {
+        // Pause until next tick
+        RtosTick::DelayUntilMs(last_wake_ticks, delay);
+      }
     }
     bucket.RemoveFullLines();
   }
 
+  // Bucket is class member - remove it from the screen
+  bucket.Hide();
+
   // Always run
   return Result::RESULT_OK;
 }
@@ -297,6 +336,10 @@ TetrisShape::TetrisShape()
 // *****************************************************************************
 void TetrisShape::RotateShape(int8_t dir)
 {
+  // Area before rotation
+  int32_t xs, ys, xe, ye;
+  GetShapeArea(xs, ys, xe, ye);
+
   // Apply rotation
   shapeRotate += dir;
   // Check underflow/overflow
@@ -308,9 +351,14 @@ void TetrisShape::RotateShape(int8_t dir)
   {
     shapeArray[shapeRtArray[shapeRotate][n]] = shapesArray[shapeNum][n];
   }
+  // Get row masks for new rotation
+  for (int32_t y = 0; y < 4; y++)
+  {
+    shapeMask[y] = shapeMasksArray[shapeNum][shapeRotate][y];
+  }
 
-  // Invalidate area, during rotation position isn't changed
-  InvalidateObjArea();
+  // Invalidate area shape rotated from and area shape rotated to
+  InvalidateShapeChange(xs, ys, xe, ye);
 }
 
 // *****************************************************************************
@@ -318,8 +366,9 @@ void TetrisShape::RotateShape(int8_t dir)
 // *****************************************************************************
 void TetrisShape::MoveShape(int8_t x, int8_t y, bool is_delta)
 {
-  // Invalidate area before move to redraw area object move from
-  InvalidateObjArea();
+  // Area before move to redraw area object move from
+  int32_t xs, ys, xe, ye;
+  GetShapeArea(xs, ys, xe, ye);
   // Make changes
   if(is_delta == true)
   {
@@ -333,15 +382,15 @@ void TetrisShape::MoveShape(int8_t x, int8_t y, bool is_delta)
     shapeTopLeftX = x;
     shapeTopLeftY = y;
   }
-  // Invalidate area after move to redraw area object move to
-  InvalidateObjArea();
+  // Invalidate area object move from and area object move to
+  InvalidateShapeChange(xs, ys, xe, ye);
 }
 
 // *****************************************************************************
 // ***   DrawShapeIntoBuffer   *************************************************
 // *****************************************************************************
 // This function copy shape to bucket
-void TetrisShape::DrawShapeIntoBuffer(uint8_t * buf, int32_t width, int32_t height)
+void TetrisShape::DrawShapeIntoBuffer(uint8_t * buf, uint16_t * rows, int32_t width, int32_t height)
 {
   for (int32_t y = 0; y < 4; y++)
   {
@@ -350,6 +399,7 @@ void TetrisShape::DrawShapeIntoBuffer(uint8_t * buf, int32_t width, int32_t heig
       if (shapeArray[y*4 + x] == true)
       {
         buf[(shapeTopLeftY + y)*width + shapeTopLeftX + x] = shapeColorIdx;
+        rows[shapeTopLeftY + y] |= 1U << (shapeTopLeftX + x);
       }
     }
   }
@@ -358,18 +408,23 @@ void TetrisShape::DrawShapeIntoBuffer(uint8_t * buf, int32_t width, int32_t heig
 // *****************************************************************************
 // ***   CheckShapeCollisionIntoBuffer   ***************************************
 // *****************************************************************************
-// This function check collision between shape and bucket
-bool TetrisShape::CheckShapeCollisionIntoBuffer(uint8_t * buf, int32_t width, int32_t height)
+// This function check collision between shape and bucket row masks. Shape
+// mask and free cells mask shifted by 4 bits to process shape columns left to
+// the bucket. Columns outside bucket treated as occupied.
+bool TetrisShape::CheckShapeCollisionIntoBuffer(const uint16_t * rows, int32_t width, int32_t height)
 {
   for(int32_t y = 0; y < 4; y++)
   {
-    for(int32_t x = 0; x < 4; x++)
+    if(shapeMask[y] != 0U)
     {
-      if(    (buf[(shapeTopLeftY + y)*width + shapeTopLeftX + x] != 0x00)
-          && (shapeArray[y*4 + x] == true) )
-      {
-        return true;
-      }
+      int32_t row = shapeTopLeftY + y;
+      // Shape row outside bucket
+      if((row < 0) || (row >= height)) return true;
+      // Shape row mask and free cells mask of bucket row
+      uint32_t mask = (uint32_t)shapeMask[y] << (shapeTopLeftX + 4);
+      uint32_t free_mask = ((~(uint32_t)rows[row]) & ((1U << width) - 1U)) << 4;
+      // Any shape cube over not free cell is collision
+      if((mask & ~free_mask) != 0U) return true;
     }
   }
   return false;
@@ -380,6 +435,9 @@ bool TetrisShape::CheckShapeCollisionIntoBuffer(uint8_t * buf, int32_t width, in
 // *****************************************************************************
 void TetrisShape::PopulateShapeArray(uint8_t shapeType, uint8_t color_idx)
 {
+  // Invalidate area of previous shape - next MoveShape() takes its area
+  // from the new shape, so previous cubes would stay on the screen
+  InvalidateObjArea();
   shapeTopLeftX = 6;
   shapeTopLeftY = 0;
   shapeNum = shapeType;
@@ -390,6 +448,10 @@ void TetrisShape::PopulateShapeArray(uint8_t shapeType, uint8_t color_idx)
   {
     shapeArray[n] = shapesArray[shapeNum][n];
   }
+  for(int32_t y = 0; y < 4; y++)
+  {
+    shapeMask[y] = shapeMasksArray[shapeNum][shapeRotate][y];
+  }
 }
 
 // *****************************************************************************
@@ -397,6 +459,9 @@ void TetrisShape::PopulateShapeArray(uint8_t shapeType, uint8_t color_idx)
 // *****************************************************************************
 void TetrisShape::PopulateShapeArray(TetrisShape& shape)
 {
+  // Invalidate area of previous shape - next MoveShape() takes its area
+  // from the new shape, so previous cubes would stay on the screen
+  InvalidateObjArea();
   shapeTopLeftX = 6;
   shapeTopLeftY = 0;
   shapeNum = shape.shapeNum;
@@ -407,6 +472,10 @@ void TetrisShape::PopulateShapeArray(TetrisShape& shape)
   {
     shapeArray[n] = shape.shapeArray[n];
   }
+  for(int32_t y = 0; y < 4; y++)
+  {
+    shapeMask[y] = shape.shapeMask[y];
+  }
 }
 
 // ***************************************************************************
@@ -446,14 +515,94 @@ void TetrisShape::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t star
 void TetrisShape::InvalidateObjArea(bool force)
 {
   // Calculate position in pixels
-  x_start = shapeTopLeftX * CUBE_SIZE;
-  x_end = (shapeTopLeftX + 4) * CUBE_SIZE;
-  y_start = shapeTopLeftY * CUBE_SIZE;
-  y_end = (shapeTopLeftY + 4) * CUBE_SIZE;
+  int32_t xs, ys, xe, ye;
+  GetShapeArea(xs, ys, xe, ye);
+  x_start = xs;
+  y_start = ys;
+  x_end = xe;
+  y_end = ye;
   // And invalidate object area
   VisObject::InvalidateObjArea();
 }
 
+// *****************************************************************************
+// ***   GetShapeArea   ********************************************************
+// *****************************************************************************
+// This function calculate area in pixels occupied by shape cubes. Empty
+// rows and columns of 4x4 shape array isn't included.
+void TetrisShape::GetShapeArea(int32_t& xs, int32_t& ys, int32_t& xe, int32_t& ye)
+{
+  int32_t min_x = 3;
+  int32_t min_y = 3;
+  int32_t max_x = 0;
+  int32_t max_y = 0;
+  for(int32_t y = 0; y < 4; y++)
+  {
+    for(int32_t x = 0; x < 4; x++)
+    {
+      if(shapeArray[y*4 + x] == true)
+      {
+        if(x < min_x) min_x = x;
+        if(x > max_x) max_x = x;
+        if(y < min_y) min_y = y;
+        if(y > max_y) max_y = y;
+      }
+    }
+  }
+  xs = (shapeTopLeftX + min_x) * CUBE_SIZE;
+  ys = (shapeTopLeftY + min_y) * CUBE_SIZE;
+  xe = (shapeTopLeftX + max_x + 1) * CUBE_SIZE - 1;
+  ye = (shapeTopLeftY + max_y + 1) * CUBE_SIZE - 1;
+}
+
+// *****************************************************************************
+// ***   InvalidateShapeChange   ***********************************************
+// *****************************************************************************
+// This function invalidate previous shape area(passed as parameters) and
+// current one. If bounding box of both areas doesn't add more than
+// AREA_MERGE_PIX pixels, it invalidated as one area. Otherwise both areas
+// invalidated separately to prevent redraw of big empty space(for example
+// when "I" shape rotates).
+void TetrisShape::InvalidateShapeChange(int32_t xs, int32_t ys, int32_t xe, int32_t ye)
+{
+  // Current area
+  int32_t nxs, nys, nxe, nye;
+  GetShapeArea(nxs, nys, nxe, nye);
+  // Bounding box of both areas
+  int32_t bxs = (xs < nxs) ? xs : nxs;
+  int32_t bys = (ys < nys) ? ys : nys;
+  int32_t bxe = (xe > nxe) ? xe : nxe;
+  int32_t bye = (ye > nye) ? ye : nye;
+  // Overlapped part of both areas
+  int32_t ow = ((xe < nxe) ? xe : nxe) - ((xs > nxs) ? xs : nxs) + 1;
+  int32_t oh = ((ye < nye) ? ye : nye) - ((ys > nys) ? ys : nys) + 1;
+  int32_t overlap = ((ow > 0) && (oh > 0)) ? ow * oh : 0;
+  // Pixels in both areas and pixels in bounding box
+  int32_t used = (xe - xs + 1) * (ye - ys + 1) + (nxe - nxs + 1) * (nye - nys + 1) - overlap;
+  int32_t bbox = (bxe - bxs + 1) * (bye - bys + 1);
+
+  // Merge areas only if it doesn't cost too much extra pixels
+  bool merge = (bbox - used <= AREA_MERGE_PIX);
+
+  // Invalidate bounding box of both areas or previous area only
+  x_start = merge ? bxs : xs;
+  y_start = merge ? bys : ys;
+  x_end = merge ? bxe : xe;
+  y_end = merge ? bye : ye;
+  VisObject::InvalidateObjArea();
+
+  // Restore object area to current one
+  x_start = nxs;
+  y_start = nys;
+  x_end = nxe;
+  y_end = nye;
+  // If areas wasn't merged - invalidate current area separately
+  if(merge == false)
+  {
+    VisObject::InvalidateObjArea();
+  }
+}
+
 // *****************************************************************************
 // ***   TetrisBucket   ********************************************************
 // *****************************************************************************
@@ -468,7 +617,7 @@ TetrisBucket::TetrisBucket()
 // * Check shape collision with bucket
 bool TetrisBucket::CheckShapeCollisionIntoBucket(TetrisShape& ts)
 {
-  return ts.CheckShapeCollisionIntoBuffer(bucket, WIDTH, HEIGHT);
+  return ts.CheckShapeCollisionIntoBuffer(rows, WIDTH, HEIGHT);
 }
 
 // *****************************************************************************
@@ -477,7 +626,12 @@ bool TetrisBucket::CheckShapeCollisionIntoBucket(TetrisShape& ts)
 // * Store shape into bucket
 void TetrisBucket::PutShapeIntoBucket(TetrisShape& ts)
 {
-  ts.DrawShapeIntoBuffer(bucket, WIDTH, HEIGHT);
+  ts.DrawShapeIntoBuffer(bucket, rows, WIDTH, HEIGHT);
+  // Update spans only for rows shape put in
+  for(int32_t y = ts.GetShapeY(); (y < ts.GetShapeY() + 4) && (y < HEIGHT); y++)
+  {
+    UpdateSpans(y);
+  }
 }
 
 // *****************************************************************************
@@ -485,20 +639,18 @@ void TetrisBucket::PutShapeIntoBucket(TetrisShape& ts)
 // *****************************************************************************
 void TetrisBucket::RemoveFullLines()
 {
-  int32_t y;
   int32_t cnt = 0;
   // Don't check last line with border
-  for (y = 0; y < HEIGHT - 1; y++)
+  for (int32_t y = 0; y < HEIGHT - 1; y++)
   {
-    int32_t x;
-    bool f = true;
-    for (x = 1; x < WIDTH-1; x++)
-    {
-      if(bucket[y*WIDTH + x] == 0x00) f = false;
-    }
-    if (f == true)
+    // Line is full if all cells and borders is occupied
+    if (rows[y] == FULL_ROW_MASK)
     {
-      memcpyback(&bucket[WIDTH], bucket, (y - 1)*WIDTH + x);
+      // Move all lines above one line down. First line stay as is.
+      memmove(&bucket[WIDTH], bucket, y*WIDTH);
+      memmove(&rows[1], rows, y*sizeof(rows[0]));
+      memmove(&spans[1], spans, y*sizeof(spans[0]));
+      memmove(&spans_cnt[1], spans_cnt, y*sizeof(spans_cnt[0]));
       cnt++;
     }
   }
@@ -525,12 +677,21 @@ void TetrisBucket::InitBucket()
   {
     bucket[y*WIDTH] = 0x07;
     bucket[y*WIDTH + WIDTH -1] = 0x07;
+    rows[y] = (1U << 0) | (1U << (WIDTH - 1));
   }
   // Fill bucket down borders with 7 color index(gray)
   for (int32_t x = 0; x < WIDTH; x++)
   {
     bucket[y*WIDTH + x] = 0x07;
   }
+  rows[y] = FULL_ROW_MASK;
+  // Clear score
+  score = 0U;
+  // Create spans for all rows
+  for (y = 0; y < HEIGHT; y++)
+  {
+    UpdateSpans(y);
+  }
   // Calculate position in pixels for InvalidateObjArea()
   x_start = 0;
   x_end = WIDTH * CUBE_SIZE;
@@ -544,41 +705,88 @@ void TetrisBucket::InitBucket()
 void TetrisBucket::DrawInBufW(color_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
   // Draw only if needed
-  if(line < HEIGHT*CUBE_SIZE)
+  if((line >= 0) && (line < HEIGHT*CUBE_SIZE))
   {
     // Convert line number to bucket line idx
     int32_t bucket_line = line/CUBE_SIZE;
-    for(int32_t i=0; i < WIDTH; i++)
+    // Draw all spans in the line
+    for(int32_t i = 0; i < spans_cnt[bucket_line]; i++)
     {
-      uint8_t color = bucket[bucket_line*WIDTH + i];
-      if(color != 0x00)
+      Span& span = spans[bucket_line][i];
+      int32_t start = (span.start * CUBE_SIZE) - start_x;
+      int32_t end = start + (span.len * CUBE_SIZE) - 1;
+      // Prevent write in memory before buffer
+      if(start < 0) start = 0;
+      // Prevent buffer overflow
+      if(end >= n) end = n - 1;
+      // Have sense draw only if span in buffer
+      if(end >= start)
       {
-        int32_t start = (i*CUBE_SIZE) - start_x;
-        int32_t end = start + CUBE_SIZE - 1;
-        // Have sense draw only if end pointer in buffer
-        if(end > 0)
-        {
-          for(int32_t i = start; i <= end; i++) buf[i] = colors[color];
-        }
+        FillSpan(&buf[start], end - start + 1, colors[span.color]);
       }
     }
   }
-  else
+}
+
+// *****************************************************************************
+// ***   UpdateSpans   *********************************************************
+// *****************************************************************************
+// * Rebuild list of same color cube runs for bucket row
+void TetrisBucket::UpdateSpans(int32_t y)
+{
+  uint8_t cnt = 0U;
+  uint8_t* row = &bucket[y*WIDTH];
+  for(int32_t x = 0; x < WIDTH; x++)
   {
-    volatile int32_t bucket_line = line/CUBE_SIZE;
-    bucket_line--;
+    // Empty cells isn't drawn
+    if(row[x] != 0x00)
+    {
+      // Extend previous span if it ends here and have the same color
+      if(   (cnt > 0U) && (spans[y][cnt - 1U].color == row[x])
+         && (spans[y][cnt - 1U].start + spans[y][cnt - 1U].len == x) )
+      {
+        spans[y][cnt - 1U].len++;
+      }
+      else
+      {
+        spans[y][cnt].start = x;
+        spans[y][cnt].len = 1U;
+        spans[y][cnt].color = row[x];
+        cnt++;
+      }
+    }
   }
+  spans_cnt[y] = cnt;
 }
 
 // *****************************************************************************
-// ***   memcpyback   **********************************************************
+// ***   FillSpan   ************************************************************
 // *****************************************************************************
-// * Copy from end to start(for overlapped blocks)
-void TetrisBucket::memcpyback(uint8_t * dst, uint8_t * src, int32_t num)
+// * Fill buffer with color. For 16 bit color two pixels stored at once.
+void TetrisBucket::FillSpan(color_t* buf, int32_t len, color_t color)
 {
-  // Copy byte-by-byte in back order
-  for (int32_t i = num-1; i >= 0; i--)
+#if defined(COLOR_16BIT)
+  // Type for store two pixels at once
+  typedef uint32_t __attribute__((__may_alias__)) color2_t;
+  // Align pointer to 32 bit
+  if((((uintptr_t)buf & 0x02U) != 0U) && (len > 0))
+  {
+    *buf++ = color;
+    len--;
+  }
+  // Store two pixels per write
+  color2_t color2 = ((color2_t)color << 16) | color;
+  color2_t* buf2 = (color2_t*)buf;
+  for(; len >= 2; len -= 2)
+  {
+    *buf2++ = color2;
+  }
+  // Store last pixel
+  if(len > 0)
   {
-    dst[i] = src[i];
+    *(color_t*)buf2 = color;
   }
+#else
+  for(int32_t i = 0; i < len; i++) buf[i] = color;
+#endif
 }
@@ -26,6 +26,7 @@
 #include "DisplayDrv.h"
 #include "InputDrv.h"
 #include "SoundDrv.h"
+#include "InputLog.h"
 
 // *****************************************************************************
 // ***   Local const variables   ***********************************************
@@ -38,63 +39,18 @@
 static const int32_t WIDTH = 12;
 // Bucket height(with low border)
 static const int32_t HEIGHT = 24;
+// Row mask for full bucket row(cubes and borders). Bit N - column N.
+static const uint16_t FULL_ROW_MASK = (1U << WIDTH) - 1U;
 // Cube size in pixels
 static const int32_t CUBE_SIZE = 10;
+// Max number of extra pixels that can be redrawn to merge two update areas in
+// one. Each area costs CASET, PASET and RAMWR commands for ILI9341 plus line
+// composition overhead in DisplayDrv, so redraw of one cube is cheaper.
+static const int32_t AREA_MERGE_PIX = CUBE_SIZE * CUBE_SIZE;
 
 // Colors for shapes
 static const color_t colors[8] = {COLOR_BLACK, COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_MAGENTA, COLOR_YELLOW, COLOR_CYAN, COLOR_DARKGREY};
 
-// *****************************************************************************
-// ***   Application Class   ***************************************************
-// *****************************************************************************
-class Tetris : public AppTask
-{
-  public:
-    // *************************************************************************
-    // ***   Get Instance   ****************************************************
-    // *************************************************************************
-    static Tetris& GetInstance(void);
-
-    // *************************************************************************
-    // ***   Tetris Loop   *****************************************************
-    // *************************************************************************
-    virtual Result Loop();
-
-  private:
-    // Game over flag
-    bool game_over = false;
-    // Round flag
-    bool round = true;
-    // drop flag
-    bool drop = false;
-
-    // Last left encoder value
-    int32_t last_enc1_val = 0;
-    // Last right encoder value
-    int32_t last_enc2_val = 0;
-    // Last left encoder button state
-    bool enc1_btn_val = false;
-    // Last left encoder button state
-    bool enc1_btn_back_val = false;
-    // Last right encoder button back state
-    bool enc2_btn_val = false;
-    // Last right encoder button back state
-    bool enc2_btn_back_val = false;
-
-    // Display driver instance
-    DisplayDrv& display_drv = DisplayDrv::GetInstance();
-    // Input driver instance
-    InputDrv& input_drv = InputDrv::GetInstance();
-    // Sound driver instance
-    SoundDrv& sound_drv = SoundDrv::GetInstance();
-
-    // *************************************************************************
-    // ** Private constructor. Only GetInstance() allow to access this class. **
-    // *************************************************************************
-    Tetris() : AppTask(APPLICATION_TASK_STACK_SIZE, APPLICATION_TASK_PRIORITY,
-                       "Tetris") {};
-};
-
 // *****************************************************************************
 // ***   TetrisShape Class   ***************************************************
 // *****************************************************************************
@@ -119,12 +75,12 @@ class TetrisShape : public VisObject
     // *************************************************************************
     // ***   DrawShapeIntoBuffer   *********************************************
     // *************************************************************************
-    void DrawShapeIntoBuffer(uint8_t * buf, int32_t width, int32_t height);
+    void DrawShapeIntoBuffer(uint8_t * buf, uint16_t * rows, int32_t width, int32_t height);
 
     // *************************************************************************
     // ***   CheckShapeCollisionIntoBuffer   ***********************************
     // *************************************************************************
-    bool CheckShapeCollisionIntoBuffer(uint8_t * buf, int32_t width, int32_t height);
+    bool CheckShapeCollisionIntoBuffer(const uint16_t * rows, int32_t width, int32_t height);
 
     // *************************************************************************
     // ***   PopulateShapeArray   **********************************************
@@ -136,6 +92,11 @@ class TetrisShape : public VisObject
     // *************************************************************************
     void PopulateShapeArray(TetrisShape& shape);
 
+    // *************************************************************************
+    // ***   GetShapeY   *******************************************************
+    // *************************************************************************
+    int32_t GetShapeY() {return shapeTopLeftY;}
+
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
@@ -152,8 +113,20 @@ class TetrisShape : public VisObject
     virtual void InvalidateObjArea(bool force = false);
 
   private:
+    // *************************************************************************
+    // ***   GetShapeArea   ****************************************************
+    // *************************************************************************
+    void GetShapeArea(int32_t& xs, int32_t& ys, int32_t& xe, int32_t& ye);
+
+    // *************************************************************************
+    // ***   InvalidateShapeChange   *******************************************
+    // *************************************************************************
+    void InvalidateShapeChange(int32_t xs, int32_t ys, int32_t xe, int32_t ye);
+
     // Current shape
     bool shapeArray[4*4] = {false};
+    // Current shape row masks. Bit N - column N of shape.
+    uint8_t shapeMask[4] = {0U};
     // Current number of shape
     int8_t shapeNum = 0;
     // Current rotation index of shape
@@ -168,6 +141,8 @@ class TetrisShape : public VisObject
 
     // Static array contains all shapes
     static const bool shapesArray[7][4*4];
+    // Static array contains row masks for all shapes and rotations
+    static const uint8_t shapeMasksArray[7][4][4];
     // Static shape rotating matrixes
     static const int8_t shapeRtArray[4][4*4];
 };
@@ -219,15 +194,89 @@ class TetrisBucket : public VisObject
     virtual void DrawInBufH(color_t* buf, int32_t n, int32_t row, int32_t start_y) {};
 
 private:
-  // Bucket buffer
+  // Bucket buffer(color indexes)
   uint8_t bucket[WIDTH*HEIGHT] = {0U};
+  // Bucket row masks(occupied cells). Bit N - column N.
+  uint16_t rows[HEIGHT] = {0U};
   // Score. Calculated in bucket, in function RemoveFullLines().
   uint32_t score = 0U;
 
+  // Span of cubes with the same color in the bucket row
+  struct Span
+  {
+    uint8_t start; // First cube
+    uint8_t len;   // Number of cubes
+    uint8_t color; // Color index
+  };
+  // Spans for each bucket row
+  Span spans[HEIGHT][WIDTH];
+  // Number of spans in each bucket row
+  uint8_t spans_cnt[HEIGHT] = {0U};
+
   // ***************************************************************************
-  // ***   Copy from end to start(for overlapped blocks)   *********************
+  // ***   UpdateSpans   *******************************************************
   // ***************************************************************************
-  static void memcpyback(uint8_t * dst, uint8_t * src, int32_t num);
+  void UpdateSpans(int32_t y);
+
+  // ***************************************************************************
+  // ***   FillSpan   **********************************************************
+  // ***************************************************************************
+  static void FillSpan(color_t* buf, int32_t len, color_t color);
+};
+
+// *****************************************************************************
+// ***   Application Class   ***************************************************
+// *****************************************************************************
+class Tetris : public AppTask
+{
+  public:
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static Tetris& GetInstance(void);
+
+    // *************************************************************************
+    // ***   Tetris Loop   *****************************************************
+    // *************************************************************************
+    virtual Result Loop();
+
+  private:
+    // Game over flag
+    bool game_over = false;
+    // Round flag
+    bool round = true;
+    // drop flag
+    bool drop = false;
+
+    // Bucket object. Kept in the class instead of Loop() stack - bucket, row
+    // masks and spans take about 1.2 KB.
+    TetrisBucket bucket;
+
+    // Last left encoder value
+    int32_t last_enc1_val = 0;
+    // Last right encoder value
+    int32_t last_enc2_val = 0;
+    // Last left encoder button state
+    bool enc1_btn_val = false;
+    // Last left encoder button state
+    bool enc1_btn_back_val = false;
+    // Last right encoder button back state
+    bool enc2_btn_val = false;
+    // Last right encoder button back state
+    bool enc2_btn_back_val = false;
+
+    // Display driver instance
+    DisplayDrv& display_drv = DisplayDrv::GetInstance();
+    // Input log instance, used instead of input driver for record & replay
+    InputLog& input_log = InputLog::GetInstance();
+    // Sound driver instance
+    SoundDrv& sound_drv = SoundDrv::GetInstance();
+
+    // *************************************************************************
+    // ** Private constructor. Only GetInstance() allow to access this class. **
+    // *************************************************************************
+    Tetris() : AppTask(APPLICATION_TASK_STACK_SIZE, APPLICATION_TASK_PRIORITY,
+                       "Tetris") {};
 };
 
 #endif